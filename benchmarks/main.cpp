@@ -1,11 +1,46 @@
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <queue>
 #include <random>
+#include <string>
 #include <thread>
 #include <vector>
+#include "concurrent/bounded_queue.hpp"
+#include "concurrent/byte_ring_queue.hpp"
+#include "concurrent/disruptor.hpp"
+#include "concurrent/flat_hash_map.hpp"
+#include "concurrent/hash.hpp"
 #include "concurrent/lockfree_queue.hpp"
 #include "concurrent/lockfree_hashmap.hpp"
+#include "concurrent/node_pool.hpp"
+#include "concurrent/priority_queue.hpp"
+#include "concurrent/segmented_queue.hpp"
+#include "concurrent/shared_queue.hpp"
+#include "concurrent/spsc_queue.hpp"
 #include "concurrent/thread_pool.hpp"
+#include "concurrent/timer_wheel.hpp"
+#include "concurrent/work_stealing_deque.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CONCURRENT_BENCH_TSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define CONCURRENT_BENCH_TSC 1
+#endif
+
+#if defined(__linux__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 using namespace concurrent;
 using namespace std::chrono;
@@ -48,7 +83,7 @@ void benchmark_queue() {
         
         // Producers
         for (int t = 0; t < num_threads / 2; ++t) {
-            threads.emplace_back([&q, num_operations, t]() {
+            threads.emplace_back([&q, num_operations, num_threads, t]() {
                 for (int i = 0; i < num_operations / (num_threads / 2); ++i) {
                     q.enqueue(i + t * 1000000);
                 }
@@ -71,6 +106,518 @@ void benchmark_queue() {
             thread.join();
         }
     }, "Multi-threaded producer-consumer (8 threads)", 1);
+
+    // Size queries as issued by monitoring, with 1M elements queued
+    LockFreeQueue<int> deep;
+    for (int i = 0; i < num_operations; ++i) {
+        deep.enqueue(i);
+    }
+    std::size_t observed = 0;
+    benchmark([&]() {
+        for (int i = 0; i < 1000; ++i) {
+            observed += deep.approximate_size();
+        }
+    }, "approximate_size x1000 (1M queued)", 1);
+    if (observed == 0) {
+        std::cout << "unexpected empty queue" << std::endl;
+    }
+}
+
+// Moves total items from producers to consumers; push and pop must retry internally
+template<typename Push, typename Pop>
+void mpmc_transfer(Push push, Pop pop, int producers, int consumers, int total) {
+    std::vector<std::thread> threads;
+    threads.reserve(producers + consumers);
+    std::atomic<int> consumed{0};
+
+    for (int t = 0; t < producers; ++t) {
+        threads.emplace_back([&push, producers, total, t]() {
+            for (int i = t; i < total; i += producers) {
+                push(i);
+            }
+        });
+    }
+    for (int t = 0; t < consumers; ++t) {
+        threads.emplace_back([&pop, &consumed, total]() {
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (pop()) {
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void benchmark_bounded_queue() {
+    std::cout << "\n=== Bounded vs Unbounded MPMC Queue Benchmarks ===" << std::endl;
+
+    constexpr int num_operations = 1000000;
+
+    for (int pairs : {1, 2, 4}) {
+        const std::string label = std::to_string(pairs) + "p" + std::to_string(pairs) + "c";
+
+        benchmark([&]() {
+            LockFreeQueue<int> q;
+            mpmc_transfer([&q](int v) { q.enqueue(v); },
+                          [&q]() { return q.dequeue().has_value(); },
+                          pairs, pairs, num_operations);
+        }, "LockFreeQueue " + label + " (1M items)", 1);
+
+        benchmark([&]() {
+            BoundedQueue<int, 1024> q;
+            mpmc_transfer([&q](int v) {
+                              while (!q.try_enqueue(v)) {
+                                  std::this_thread::yield();
+                              }
+                          },
+                          [&q]() { return q.try_dequeue().has_value(); },
+                          pairs, pairs, num_operations);
+        }, "BoundedQueue<1024> " + label + " (1M items)", 1);
+    }
+}
+
+void benchmark_shared_queue() {
+#if defined(__linux__)
+    std::cout << "\n=== Interprocess Queue Benchmarks ===" << std::endl;
+
+    struct Message {
+        std::uint64_t sequence;
+        char payload[56];
+    };
+    constexpr int num_messages = 1000000;
+
+    // The producer is a forked child process in both cases
+    benchmark([&]() {
+        int fds[2];
+        if (::pipe(fds) != 0) {
+            return;
+        }
+        pid_t child = ::fork();
+        if (child == 0) {
+            ::close(fds[0]);
+            Message message{};
+            for (int i = 0; i < num_messages; ++i) {
+                message.sequence = static_cast<std::uint64_t>(i);
+                if (::write(fds[1], &message, sizeof(message)) != sizeof(message)) {
+                    ::_exit(1);
+                }
+            }
+            ::_exit(0);
+        }
+        ::close(fds[1]);
+        Message message;
+        for (int i = 0; i < num_messages; ++i) {
+            std::size_t got = 0;
+            while (got < sizeof(message)) {
+                ssize_t n = ::read(fds[0], reinterpret_cast<char*>(&message) + got,
+                                   sizeof(message) - got);
+                if (n <= 0) {
+                    break;
+                }
+                got += static_cast<std::size_t>(n);
+            }
+        }
+        ::close(fds[0]);
+        ::waitpid(child, nullptr, 0);
+    }, "pipe 64-byte messages, 2 processes (1M msgs)", 1);
+
+    benchmark([&]() {
+        auto q = SharedBoundedQueue<Message, 1024>::create_anonymous();
+        pid_t child = ::fork();
+        if (child == 0) {
+            Message message{};
+            for (int i = 0; i < num_messages; ++i) {
+                message.sequence = static_cast<std::uint64_t>(i);
+                while (!q.try_enqueue(message)) {
+                    std::this_thread::yield();
+                }
+            }
+            ::_exit(0);
+        }
+        for (int received = 0; received < num_messages;) {
+            if (q.try_dequeue()) {
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        ::waitpid(child, nullptr, 0);
+    }, "SharedBoundedQueue<1024> 64-byte messages, 2 processes (1M msgs)", 1);
+#endif
+}
+
+void benchmark_blocking_dequeue() {
+    std::cout << "\n=== Blocking Dequeue Benchmarks ===" << std::endl;
+
+    constexpr int round_trips = 20000;
+
+    // Ping-pong between two threads: every hop wakes a parked consumer
+    double us = benchmark([&]() {
+        LockFreeQueue<int> ping;
+        LockFreeQueue<int> pong;
+        std::thread echo([&ping, &pong, round_trips]() {
+            for (int i = 0; i < round_trips; ++i) {
+                pong.enqueue(ping.dequeue_wait());
+            }
+        });
+        for (int i = 0; i < round_trips; ++i) {
+            ping.enqueue(i);
+            pong.dequeue_wait();
+        }
+        echo.join();
+    }, "dequeue_wait ping-pong (20K round trips)", 1);
+    std::cout << "  -> " << us / round_trips << " μs per round trip" << std::endl;
+
+    // An idle consumer should not burn CPU while parked
+    std::clock_t cpu_start = std::clock();
+    benchmark([&]() {
+        LockFreeQueue<int> q;
+        std::thread consumer([&q]() {
+            q.dequeue_for(std::chrono::milliseconds(200));
+        });
+        consumer.join();
+    }, "Idle dequeue_for(200ms)", 1);
+    std::cout << "  -> " << 1000.0 * (std::clock() - cpu_start) / CLOCKS_PER_SEC
+              << " ms CPU time" << std::endl;
+}
+
+void benchmark_queue_bulk() {
+    std::cout << "\n=== Lock-Free Queue Bulk Benchmarks ===" << std::endl;
+
+    constexpr int num_operations = 1 << 20;
+    constexpr int pairs = 2;
+    std::vector<int> input(256);
+
+    for (int batch : {1, 8, 32, 64, 128, 256}) {
+        double us = benchmark([&]() {
+            LockFreeQueue<int> q;
+            std::vector<int> out(batch);
+            for (int i = 0; i < num_operations; i += batch) {
+                q.enqueue_bulk(input.begin(), input.begin() + batch);
+                q.try_dequeue_bulk(out.begin(), batch);
+            }
+        }, "Bulk single-threaded, batch " + std::to_string(batch) + " (1M items)", 1);
+        std::cout << "  -> " << us * 1000.0 / num_operations << " ns/element" << std::endl;
+
+        us = benchmark([&]() {
+            LockFreeQueue<int> q;
+            std::vector<std::thread> threads;
+            std::atomic<int> consumed{0};
+
+            for (int t = 0; t < pairs; ++t) {
+                threads.emplace_back([&q, &input, batch, pairs]() {
+                    for (int i = 0; i < num_operations / pairs; i += batch) {
+                        q.enqueue_bulk(input.begin(), input.begin() + batch);
+                    }
+                });
+                threads.emplace_back([&q, &consumed, batch]() {
+                    std::vector<int> out(batch);
+                    while (consumed.load(std::memory_order_relaxed) < num_operations) {
+                        std::size_t n = q.try_dequeue_bulk(out.begin(), batch);
+                        if (n == 0) {
+                            std::this_thread::yield();
+                        }
+                        consumed.fetch_add(static_cast<int>(n), std::memory_order_relaxed);
+                    }
+                });
+            }
+
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }, "Bulk 2p2c, batch " + std::to_string(batch) + " (1M items)", 1);
+        std::cout << "  -> " << us * 1000.0 / num_operations << " ns/element" << std::endl;
+    }
+}
+
+// Runs the same transfer over a range of thread counts (half producers, half consumers)
+template<typename Queue>
+void queue_scaling_sweep(const std::string& name, int total, int max_threads) {
+    benchmark([&]() {
+        Queue q;
+        for (int i = 0; i < total; ++i) {
+            q.enqueue(i);
+        }
+        for (int i = 0; i < total; ++i) {
+            q.dequeue();
+        }
+    }, name + " 1 thread (1M items)", 1);
+
+    for (int threads = 2; threads <= max_threads; threads *= 2) {
+        benchmark([&]() {
+            Queue q;
+            mpmc_transfer([&q](int v) { q.enqueue(v); },
+                          [&q]() { return q.dequeue().has_value(); },
+                          threads / 2, threads / 2, total);
+        }, name + " " + std::to_string(threads) + " threads (1M items)", 1);
+    }
+}
+
+// Producers each enqueue through their own token; consumers rotate across lanes
+void token_transfer(int producers, int consumers, int total) {
+    LockFreeQueue<int> q;
+    std::vector<std::thread> threads;
+    threads.reserve(producers + consumers);
+    std::atomic<int> consumed{0};
+
+    for (int t = 0; t < producers; ++t) {
+        threads.emplace_back([&q, producers, total, t]() {
+            auto token = q.make_producer_token();
+            for (int i = t; i < total; i += producers) {
+                q.enqueue(token, i);
+            }
+        });
+    }
+    for (int t = 0; t < consumers; ++t) {
+        threads.emplace_back([&q, &consumed, total]() {
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (q.dequeue()) {
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void benchmark_queue_scaling() {
+    std::cout << "\n=== MPMC Queue Thread Scaling ===" << std::endl;
+
+    constexpr int num_operations = 1000000;
+    const int max_threads =
+        std::max(16, 2 * static_cast<int>(std::thread::hardware_concurrency()));
+
+    queue_scaling_sweep<LockFreeQueue<int>>("LockFreeQueue", num_operations, max_threads);
+    queue_scaling_sweep<SegmentedQueue<int>>("SegmentedQueue", num_operations, max_threads);
+
+    for (int threads = 2; threads <= max_threads; threads *= 2) {
+        benchmark([&]() {
+            token_transfer(threads / 2, threads / 2, num_operations);
+        }, "LockFreeQueue+tokens " + std::to_string(threads) + " threads (1M items)", 1);
+    }
+}
+
+void benchmark_spsc_queue() {
+    std::cout << "\n=== SPSC Queue Benchmarks ===" << std::endl;
+
+    constexpr int num_operations = 10000000;
+
+    auto report = [](double us) {
+        std::cout << "  -> " << num_operations / us << " M ops/s" << std::endl;
+    };
+
+    report(benchmark([&]() {
+        LockFreeQueue<int> q;
+        mpmc_transfer([&q](int v) { q.enqueue(v); },
+                      [&q]() { return q.dequeue().has_value(); },
+                      1, 1, num_operations);
+    }, "LockFreeQueue 1p1c (10M items)", 1));
+
+    report(benchmark([&]() {
+        SpscQueue<int> q(4096);
+        mpmc_transfer([&q](int v) {
+                          while (!q.try_enqueue(v)) {
+                              std::this_thread::yield();
+                          }
+                      },
+                      [&q]() { return q.try_dequeue().has_value(); },
+                      1, 1, num_operations);
+    }, "SpscQueue 1p1c (10M items)", 1));
+
+    report(benchmark([&]() {
+        constexpr int batch = 64;
+        SpscQueue<int> q(4096);
+        std::thread producer([&q]() {
+            int buffer[batch];
+            for (int base = 0; base < num_operations; base += batch) {
+                for (int i = 0; i < batch; ++i) {
+                    buffer[i] = base + i;
+                }
+                std::size_t sent = 0;
+                while (sent < batch) {
+                    sent += q.try_enqueue_bulk(buffer + sent, batch - sent);
+                    if (sent < batch) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        });
+
+        int sink[batch];
+        int consumed = 0;
+        while (consumed < num_operations) {
+            std::size_t n = q.try_dequeue_bulk(sink, batch);
+            if (n == 0) {
+                std::this_thread::yield();
+            }
+            consumed += static_cast<int>(n);
+        }
+        producer.join();
+    }, "SpscQueue bulk x64 1p1c (10M items)", 1));
+}
+
+void benchmark_byte_ring_queue() {
+    std::cout << "\n=== Byte Message Benchmarks ===" << std::endl;
+
+    // Serialized blobs of 40..4000 bytes, as message-passing layers ship them
+    constexpr int num_messages = 1000000;
+    std::vector<std::size_t> sizes(1024);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> size_dist(40, 4000);
+    for (auto& size : sizes) {
+        size = size_dist(rng);
+    }
+    const std::vector<char> payload(4000, 'x');
+
+    auto report = [](double us) {
+        std::cout << "  -> " << num_messages / us << " M msgs/s" << std::endl;
+    };
+
+    report(benchmark([&]() {
+        LockFreeQueue<std::vector<char>> q;
+        std::thread producer([&]() {
+            for (int i = 0; i < num_messages; ++i) {
+                std::size_t size = sizes[i & 1023];
+                q.enqueue(std::vector<char>(payload.begin(), payload.begin() + size));
+            }
+        });
+        std::size_t bytes = 0;
+        for (int received = 0; received < num_messages;) {
+            if (auto message = q.dequeue()) {
+                bytes += message->size();
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+    }, "LockFreeQueue<vector<char>> 1p1c (1M msgs)", 1));
+
+    report(benchmark([&]() {
+        ByteRingQueue q(256 * 1024);
+        std::thread producer([&]() {
+            for (int i = 0; i < num_messages; ++i) {
+                std::size_t size = sizes[i & 1023];
+                ByteRingQueue::WriteReservation w;
+                while (!(w = q.reserve(size))) {
+                    std::this_thread::yield();
+                }
+                std::memcpy(w.data(), payload.data(), size);
+                w.commit();
+            }
+        });
+        std::size_t bytes = 0;
+        for (int received = 0; received < num_messages;) {
+            if (auto message = q.read()) {
+                bytes += message.size();
+                message.release();
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+    }, "ByteRingQueue 1p1c (1M msgs)", 1));
+}
+
+// Allocates on this thread and frees on another, as queue producers and consumers do
+template<typename Alloc, typename Free>
+void cross_thread_churn(Alloc alloc, Free release, int total, int batch) {
+    std::atomic<std::vector<void*>*> mailbox{nullptr};
+
+    std::thread consumer([&mailbox, &release, total]() {
+        int freed = 0;
+        while (freed < total) {
+            std::vector<void*>* chunk = mailbox.exchange(nullptr, std::memory_order_acquire);
+            if (!chunk) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (void* block : *chunk) {
+                release(block);
+            }
+            freed += static_cast<int>(chunk->size());
+            delete chunk;
+        }
+    });
+
+    for (int produced = 0; produced < total; produced += batch) {
+        auto* chunk = new std::vector<void*>(batch);
+        for (auto& block : *chunk) {
+            block = alloc();
+        }
+        std::vector<void*>* expected = nullptr;
+        while (!mailbox.compare_exchange_weak(expected, chunk, std::memory_order_release)) {
+            expected = nullptr;
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+}
+
+void benchmark_node_pool() {
+    std::cout << "\n=== Node Pool Benchmarks ===" << std::endl;
+
+    constexpr int num_operations = 1000000;
+    constexpr int batch = 256;
+
+    // Same shape as a queue node holding a small payload
+    struct FakeNode {
+        std::atomic<FakeNode*> next{nullptr};
+        int value = 0;
+    };
+
+    std::vector<void*> blocks(batch);
+
+    benchmark([&]() {
+        for (int i = 0; i < num_operations / batch; ++i) {
+            for (auto& block : blocks) {
+                block = new FakeNode();
+            }
+            for (void* block : blocks) {
+                delete static_cast<FakeNode*>(block);
+            }
+        }
+    }, "operator new/delete, same thread (1M nodes)", 1);
+
+    benchmark([&]() {
+        for (int i = 0; i < num_operations / batch; ++i) {
+            for (auto& block : blocks) {
+                block = new (NodePool<FakeNode>::allocate()) FakeNode();
+            }
+            for (void* block : blocks) {
+                static_cast<FakeNode*>(block)->~FakeNode();
+                NodePool<FakeNode>::deallocate(block);
+            }
+        }
+    }, "SlabPool, same thread (1M nodes)", 1);
+
+    benchmark([&]() {
+        cross_thread_churn([]() -> void* { return new FakeNode(); },
+                           [](void* block) { delete static_cast<FakeNode*>(block); },
+                           num_operations, batch);
+    }, "operator new/delete, cross-thread free (1M nodes)", 1);
+
+    benchmark([&]() {
+        cross_thread_churn([]() -> void* { return new (NodePool<FakeNode>::allocate()) FakeNode(); },
+                           [](void* block) {
+                               static_cast<FakeNode*>(block)->~FakeNode();
+                               NodePool<FakeNode>::deallocate(block);
+                           },
+                           num_operations, batch);
+    }, "SlabPool, cross-thread free (1M nodes)", 1);
 }
 
 void benchmark_hashmap() {
@@ -97,7 +644,7 @@ void benchmark_hashmap() {
         std::vector<std::thread> threads;
         
         for (int t = 0; t < num_threads; ++t) {
-            threads.emplace_back([&m, num_operations, t]() {
+            threads.emplace_back([&m, num_operations, num_threads, t]() {
                 for (int i = 0; i < num_operations / num_threads; ++i) {
                     int key = i + t * 10000;
                     m.insert(key, key * 2);
@@ -110,6 +657,450 @@ void benchmark_hashmap() {
             thread.join();
         }
     }, "Multi-threaded concurrent ops (8 threads)", 1);
+
+    // Growth from the default 1024 buckets: with a fixed table the chains grow
+    // linearly with the key count, so per-key cost would climb with size
+    for (int keys : {1000000, 4000000, 16000000}) {
+        LockFreeHashMap<int, int> grown;
+        const std::string label = std::to_string(keys / 1000000) + "M keys";
+        double insert_us = benchmark([&]() {
+            for (int i = 0; i < keys; ++i) {
+                grown.insert(i, i);
+            }
+        }, "Growing insert (" + label + ")", 1);
+        double lookup_us = benchmark([&]() {
+            for (int i = 0; i < keys; ++i) {
+                grown.get(i);
+            }
+        }, "Lookup after growth (" + label + ")", 1);
+        std::cout << "  per key: insert " << insert_us * 1000.0 / keys << " ns, lookup "
+                  << lookup_us * 1000.0 / keys << " ns, " << grown.bucket_count()
+                  << " buckets" << std::endl;
+    }
+}
+
+// Bucket index of every key, summed so the loop is not optimized away;
+// prints time and, where there is a TSC, reference cycles per key
+template<typename Index>
+void index_cost(const std::vector<std::uint64_t>& keys, Index index, const std::string& name) {
+    std::size_t sink = 0;
+#if defined(CONCURRENT_BENCH_TSC)
+    const std::uint64_t start_ticks = __rdtsc();
+#endif
+    double us = benchmark([&]() {
+        for (std::uint64_t key : keys) {
+            sink += index(key);
+        }
+    }, name, 1);
+#if defined(CONCURRENT_BENCH_TSC)
+    const double ticks = static_cast<double>(__rdtsc() - start_ticks) / keys.size();
+#endif
+    std::cout << "  per key: " << us * 1000.0 / keys.size() << " ns";
+#if defined(CONCURRENT_BENCH_TSC)
+    std::cout << ", " << ticks << " TSC cycles";
+#endif
+    std::cout << " (checksum " << (sink & 0xFF) << ")" << std::endl;
+}
+
+void benchmark_hash_policy() {
+    std::cout << "\n=== Hash Map Bucket Indexing ===" << std::endl;
+
+    // A prime count as a modulo table would use vs the power of two above it
+    constexpr std::size_t prime_buckets = 1048573;
+    constexpr std::size_t mask = (std::size_t{1} << 20) - 1;
+    std::vector<std::uint64_t> keys(10000000);
+    std::mt19937_64 rng(42);
+    for (auto& key : keys) {
+        key = rng();
+    }
+    // The divisor is opaque so the compiler cannot strength-reduce the modulo
+    volatile std::size_t divisor = prime_buckets;
+    const std::size_t runtime_divisor = divisor;
+    index_cost(keys,
+               [&](std::uint64_t key) {
+                   return std::hash<std::uint64_t>{}(key) % runtime_divisor;
+               },
+               "std::hash % prime (10M keys)");
+    index_cost(keys, [](std::uint64_t key) { return MixHash<std::uint64_t>{}(key) & mask; },
+               "MixHash & mask (10M keys)");
+
+    // Keys that differ only above bit 12: identity hashing leaves them all in
+    // bucket 0 until the table outgrows the stride
+    constexpr int strided_keys = 20000;
+    for (bool mixed : {false, true}) {
+        auto workload = [&](auto& map) {
+            for (int i = 0; i < strided_keys; ++i) {
+                map.insert(i * 4096, i);
+            }
+            for (int i = 0; i < strided_keys; ++i) {
+                map.get(i * 4096);
+            }
+        };
+        const std::string label = mixed ? "MixHash" : "std::hash";
+        double us = benchmark([&]() {
+            if (mixed) {
+                LockFreeHashMap<int, int> map;
+                workload(map);
+            } else {
+                LockFreeHashMap<int, int, std::hash<int>> map;
+                workload(map);
+            }
+        }, "LockFreeHashMap strided insert+get 20K, " + label, 1);
+        std::cout << "  per op: " << us * 1000.0 / (2 * strided_keys) << " ns" << std::endl;
+    }
+
+    // Sequential keys are identity hashing's best case; mixing must not cost much here
+    for (bool mixed : {false, true}) {
+        const std::string label = mixed ? "MixHash" : "std::hash";
+        benchmark([&]() {
+            auto workload = [](auto& map) {
+                for (int i = 0; i < 1000000; ++i) {
+                    map.insert(i, i);
+                }
+                for (int i = 0; i < 1000000; ++i) {
+                    map.get(i);
+                }
+            };
+            if (mixed) {
+                LockFreeHashMap<int, int> map;
+                workload(map);
+            } else {
+                LockFreeHashMap<int, int, std::hash<int>> map;
+                workload(map);
+            }
+        }, "LockFreeHashMap sequential insert+get 1M, " + label, 1);
+    }
+}
+
+// Threads insert disjoint slices of keys, then look up every key of their slice
+template<typename Map, typename K>
+void map_workload(Map& map, const std::vector<K>& keys, int num_threads) {
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&map, &keys, num_threads, t]() {
+            for (size_t i = t; i < keys.size(); i += num_threads) {
+                map.insert(keys[i], static_cast<int>(i));
+            }
+            for (size_t i = t; i < keys.size(); i += num_threads) {
+                map.get(keys[i]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void benchmark_flat_hash_map() {
+    std::cout << "\n=== Flat Concurrent Hash Map Benchmarks ===" << std::endl;
+
+    std::vector<int> int_keys(1000000);
+    for (size_t i = 0; i < int_keys.size(); ++i) {
+        int_keys[i] = static_cast<int>(i);
+    }
+    std::vector<std::string> string_keys(200000);
+    for (size_t i = 0; i < string_keys.size(); ++i) {
+        string_keys[i] = "user:" + std::to_string(i * 2654435761u);
+    }
+
+    // Both maps start small and grow; inline slots vs chained nodes
+    for (int num_threads : {1, 4}) {
+        const std::string threads_label = " (" + std::to_string(num_threads) + " threads)";
+        benchmark([&]() {
+            LockFreeHashMap<int, int> map;
+            map_workload(map, int_keys, num_threads);
+        }, "LockFreeHashMap int insert+get 1M" + threads_label, 1);
+        benchmark([&]() {
+            FlatConcurrentHashMap<int, int> map;
+            map_workload(map, int_keys, num_threads);
+        }, "FlatConcurrentHashMap int insert+get 1M" + threads_label, 1);
+        benchmark([&]() {
+            LockFreeHashMap<std::string, int> map;
+            map_workload(map, string_keys, num_threads);
+        }, "LockFreeHashMap string insert+get 200K" + threads_label, 1);
+        benchmark([&]() {
+            FlatConcurrentHashMap<std::string, int> map;
+            map_workload(map, string_keys, num_threads);
+        }, "FlatConcurrentHashMap string insert+get 200K" + threads_label, 1);
+    }
+}
+
+// Owner pushes everything and pops a third of it while thieves steal the rest
+void steal_workload(int num_thieves, int total) {
+    WorkStealingDeque<int> deque;
+    std::atomic<int> taken{0};
+    std::vector<std::thread> thieves;
+    thieves.reserve(num_thieves);
+
+    for (int t = 0; t < num_thieves; ++t) {
+        thieves.emplace_back([&deque, &taken, total]() {
+            while (taken.load(std::memory_order_relaxed) < total) {
+                if (deque.steal()) {
+                    taken.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < total; ++i) {
+        deque.push(i);
+        if (i % 3 == 0 && deque.pop()) {
+            taken.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    while (taken.load(std::memory_order_relaxed) < total) {
+        if (deque.pop()) {
+            taken.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+}
+
+void benchmark_work_stealing_deque() {
+    std::cout << "\n=== Work-Stealing Deque Benchmarks ===" << std::endl;
+
+    constexpr int num_operations = 1000000;
+
+    benchmark([&]() {
+        WorkStealingDeque<int> deque;
+        for (int i = 0; i < num_operations; ++i) {
+            deque.push(i);
+        }
+        for (int i = 0; i < num_operations; ++i) {
+            deque.pop();
+        }
+    }, "Owner only push/pop (1M items)", 1);
+
+    benchmark([&]() {
+        steal_workload(1, num_operations);
+    }, "Owner + 1 thief (1M items)", 1);
+
+    const int many = std::max(4, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+    benchmark([&]() {
+        steal_workload(many, num_operations);
+    }, "Owner + " + std::to_string(many) + " thieves (1M items)", 1);
+}
+
+// 64-byte message, the kind of payload that is fanned out to several consumers
+struct FanOutMessage {
+    std::int64_t sequence = 0;
+    std::array<char, 56> payload{};
+};
+
+void benchmark_disruptor() {
+    std::cout << "\n=== Disruptor Fan-Out Benchmarks ===" << std::endl;
+
+    constexpr std::int64_t num_events = 1000000;
+
+    for (int fan_out : {1, 2, 4}) {
+        std::string suffix = " 1p" + std::to_string(fan_out) + "c (1M events)";
+
+        benchmark([&]() {
+            // One LockFreeQueue per consumer: every event is copied fan_out times
+            std::vector<std::unique_ptr<LockFreeQueue<FanOutMessage>>> queues;
+            for (int c = 0; c < fan_out; ++c) {
+                queues.push_back(std::make_unique<LockFreeQueue<FanOutMessage>>());
+            }
+            std::vector<std::thread> threads;
+            threads.reserve(fan_out + 1);
+            for (int c = 0; c < fan_out; ++c) {
+                threads.emplace_back([&queues, c]() {
+                    for (std::int64_t received = 0; received < num_events;) {
+                        if (queues[c]->dequeue()) {
+                            ++received;
+                        } else {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+            threads.emplace_back([&queues]() {
+                FanOutMessage message;
+                for (std::int64_t i = 0; i < num_events; ++i) {
+                    message.sequence = i;
+                    for (auto& queue : queues) {
+                        queue->enqueue(message);
+                    }
+                }
+            });
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }, "LockFreeQueue per consumer" + suffix, 1);
+
+        benchmark([&]() {
+            Disruptor<FanOutMessage> ring(4096);
+            std::vector<Disruptor<FanOutMessage>::Consumer*> consumers;
+            for (int c = 0; c < fan_out; ++c) {
+                consumers.push_back(&ring.add_consumer());
+            }
+            std::vector<std::thread> threads;
+            threads.reserve(fan_out + 1);
+            for (int c = 0; c < fan_out; ++c) {
+                threads.emplace_back([consumer = consumers[c]]() {
+                    while (consumer->sequence() < num_events - 1) {
+                        if (consumer->poll([](FanOutMessage&, std::int64_t) {}) == 0) {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+            threads.emplace_back([&ring]() {
+                for (std::int64_t i = 0; i < num_events; ++i) {
+                    ring.publish_event([i](FanOutMessage& m, std::int64_t) { m.sequence = i; });
+                }
+            });
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }, "Disruptor" + suffix, 1);
+    }
+}
+
+// Baseline: std::priority_queue behind a mutex
+class LockedPriorityQueue {
+public:
+    void push(int key, int value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        heap_.emplace(key, value);
+    }
+
+    std::optional<std::pair<int, int>> try_pop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (heap_.empty()) {
+            return std::nullopt;
+        }
+        auto top = heap_.top();
+        heap_.pop();
+        return top;
+    }
+
+private:
+    std::mutex mutex_;
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>,
+                        std::greater<std::pair<int, int>>> heap_;
+};
+
+// Every thread alternates a push of a random key with a pop on a prefilled queue
+template<typename Queue, typename Pop>
+void priority_mix(Queue& queue, Pop pop, int threads, int total) {
+    constexpr int prefill = 1024;
+    std::mt19937 rng(42);
+    for (int i = 0; i < prefill; ++i) {
+        queue.push(static_cast<int>(rng() % 1000000), i);
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&queue, &pop, threads, total, t]() {
+            std::mt19937 local(t);
+            for (int i = t; i < total; i += threads) {
+                queue.push(static_cast<int>(local() % 1000000), i);
+                pop(queue);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void benchmark_priority_queue() {
+    std::cout << "\n=== Priority Queue Benchmarks ===" << std::endl;
+
+    constexpr int num_operations = 200000;
+
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        std::string suffix = " " + std::to_string(threads) + " threads (200K push+pop)";
+
+        benchmark([&]() {
+            LockedPriorityQueue queue;
+            priority_mix(queue, [](auto& q) { q.try_pop(); }, threads, num_operations);
+        }, "std::priority_queue + mutex" + suffix, 1);
+
+        benchmark([&]() {
+            ConcurrentPriorityQueue<int, int> queue(threads);
+            priority_mix(queue, [](auto& q) { q.try_pop(); }, threads, num_operations);
+        }, "ConcurrentPriorityQueue exact" + suffix, 1);
+
+        benchmark([&]() {
+            ConcurrentPriorityQueue<int, int> queue(threads);
+            priority_mix(queue, [](auto& q) { q.try_pop_relaxed(); }, threads, num_operations);
+        }, "ConcurrentPriorityQueue relaxed" + suffix, 1);
+    }
+}
+
+void benchmark_timer_wheel() {
+    std::cout << "\n=== Timer Wheel Benchmarks ===" << std::endl;
+
+    // 1M outstanding timers due within 10s, scheduled from 4 threads, then
+    // expired by one consumer sweeping simulated time in 1ms steps
+    using Clock = std::chrono::steady_clock;
+    constexpr int num_timers = 1000000;
+    constexpr int num_producers = 4;
+    constexpr int horizon_ms = 10000;
+
+    auto schedule_all = [&](auto&& schedule, Clock::time_point start) {
+        std::vector<std::thread> threads;
+        threads.reserve(num_producers);
+        for (int p = 0; p < num_producers; ++p) {
+            threads.emplace_back([&, p]() {
+                std::mt19937 rng(p);
+                std::uniform_int_distribution<int> delay(1, horizon_ms);
+                for (int i = p; i < num_timers; i += num_producers) {
+                    schedule(i, start + milliseconds(delay(rng)));
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    };
+
+    {
+        std::mutex mutex;
+        using Entry = std::pair<Clock::time_point, int>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+        const auto start = Clock::now();
+        benchmark([&]() {
+            schedule_all([&](int id, Clock::time_point due) {
+                std::lock_guard<std::mutex> lock(mutex);
+                heap.emplace(due, id);
+            }, start);
+        }, "std::priority_queue + mutex: schedule 1M (4 threads)", 1);
+        benchmark([&]() {
+            std::size_t expired = 0;
+            for (int ms = 1; ms <= horizon_ms; ++ms) {
+                const auto now = start + milliseconds(ms);
+                std::lock_guard<std::mutex> lock(mutex);
+                while (!heap.empty() && heap.top().first <= now) {
+                    heap.pop();
+                    ++expired;
+                }
+            }
+        }, "std::priority_queue + mutex: expire 1M over 10K polls", 1);
+    }
+
+    {
+        TimerWheel<int> wheel(milliseconds(1));
+        const auto start = Clock::now();
+        benchmark([&]() {
+            schedule_all([&](int id, Clock::time_point due) { wheel.schedule(id, due); }, start);
+        }, "TimerWheel: schedule 1M (4 threads)", 1);
+        benchmark([&]() {
+            std::size_t expired = 0;
+            for (int ms = 1; ms <= horizon_ms + 1; ++ms) {
+                expired += wheel.poll(start + milliseconds(ms), [](int) {});
+            }
+        }, "TimerWheel: expire 1M over 10K polls", 1);
+    }
 }
 
 void benchmark_thread_pool() {
@@ -148,7 +1139,21 @@ int main() {
     std::cout << "=====================================================\n";
     
     benchmark_queue();
+    benchmark_blocking_dequeue();
+    benchmark_queue_bulk();
+    benchmark_bounded_queue();
+    benchmark_shared_queue();
+    benchmark_queue_scaling();
+    benchmark_spsc_queue();
+    benchmark_byte_ring_queue();
+    benchmark_node_pool();
     benchmark_hashmap();
+    benchmark_hash_policy();
+    benchmark_flat_hash_map();
+    benchmark_work_stealing_deque();
+    benchmark_priority_queue();
+    benchmark_disruptor();
+    benchmark_timer_wheel();
     benchmark_thread_pool();
     
     std::cout << "\nBenchmarks completed!" << std::endl;
@@ -147,14 +147,14 @@ void auto_producer() {
 
 void auto_consumer() {
     while (g_auto_consumer_running.load()) {
-        auto start = std::chrono::high_resolution_clock::now();
-        auto item = g_queue.dequeue();
-        auto end = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-        if (item.has_value()) {
-            g_stats.record_operation_time(duration);
-            g_stats.queue_dequeued.fetch_add(1);
+        // Park instead of polling; the timeout bounds how long stopping takes
+        auto item = g_queue.dequeue_for(std::chrono::milliseconds(100));
+        if (!item.has_value()) {
+            continue;
         }
+        g_stats.queue_dequeued.fetch_add(1);
+
+        // Pace consumption below the producer rate so the queue visibly fills
         std::this_thread::sleep_for(std::chrono::milliseconds(150));
     }
 }
@@ -304,25 +304,10 @@ int main() {
         
         // Update queue snapshot periodically (non-destructive)
         if (std::chrono::duration_cast<std::chrono::milliseconds>(now - last_snapshot_update).count() > 500) {
-            // Create snapshot without modifying the actual queue
             std::vector<int> snapshot;
-            LockFreeQueue<int> temp_queue;
-            int count = 0;
-            while (!g_queue.empty() && count < 50) {
-                auto item = g_queue.dequeue();
-                if (item.has_value()) {
-                    snapshot.push_back(item.value());
-                    temp_queue.enqueue(item.value());
-                }
-                count++;
-            }
-            // Restore queue
-            while (!temp_queue.empty()) {
-                auto item = temp_queue.dequeue();
-                if (item.has_value()) {
-                    g_queue.enqueue(item.value());
-                }
-            }
+            g_queue.for_each_snapshot(50, [&snapshot](const int& value) {
+                snapshot.push_back(value);
+            });
             g_stats.update_queue_snapshot(snapshot);
             last_snapshot_update = now;
         }
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace concurrent {
+
+/**
+ * @brief Bounded multi-producer multi-consumer ring-buffer queue
+ *
+ * Implements Dmitry Vyukov's sequence-slot design: every slot carries a
+ * sequence number that tells producers and consumers whether it is free for
+ * the current lap or holds an element, so a single CAS on the shared
+ * enqueue/dequeue position claims a slot and no other synchronization is
+ * needed. Slots are cache-line padded to keep neighbouring operations from
+ * false sharing. All memory is allocated at construction; operations never
+ * allocate.
+ *
+ * @tparam T The type of elements stored in the queue
+ * @tparam Capacity Number of slots (must be a power of two)
+ */
+template<typename T, std::size_t Capacity>
+class BoundedQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "T must be nothrow move constructible");
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<std::size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    static constexpr std::size_t kMask = Capacity - 1;
+
+    std::unique_ptr<Slot[]> slots_;
+    alignas(64) std::atomic<std::size_t> enqueue_pos_{0};
+    alignas(64) std::atomic<std::size_t> dequeue_pos_{0};
+
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots_[pos & kMask];
+            std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                // Slot is free for this lap - try to claim it
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // Slot still holds last lap's element: full
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (slot->storage) T(std::forward<Args>(args)...);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+public:
+    /**
+     * @brief Constructs an empty queue, allocating all Capacity slots
+     */
+    BoundedQueue() : slots_(new Slot[Capacity]) {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Destructor - not thread-safe, destroys remaining elements
+     */
+    ~BoundedQueue() {
+        std::size_t end = enqueue_pos_.load(std::memory_order_relaxed);
+        for (std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed); pos != end; ++pos) {
+            Slot& slot = slots_[pos & kMask];
+            if (slot.sequence.load(std::memory_order_relaxed) == pos + 1) {
+                slot.value()->~T();
+            }
+        }
+    }
+
+    // Non-copyable, non-movable
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+    BoundedQueue(BoundedQueue&&) = delete;
+    BoundedQueue& operator=(BoundedQueue&&) = delete;
+
+    /**
+     * @brief Attempts to enqueue an item
+     *
+     * @param item The item to move into the queue (left untouched on failure)
+     * @return true if enqueued, false if the queue is full
+     */
+    bool try_enqueue(T&& item) {
+        return emplace(std::move(item));
+    }
+
+    /**
+     * @brief Attempts to enqueue a copy of an item
+     *
+     * @param item The item to copy into the queue
+     * @return true if enqueued, false if the queue is full
+     */
+    bool try_enqueue(const T& item) {
+        // Copy before claiming a slot so a throwing copy cannot stall the ring
+        return emplace(T(item));
+    }
+
+    /**
+     * @brief Attempts to dequeue an item
+     *
+     * @return std::optional<T> containing the item, empty if the queue is empty
+     */
+    std::optional<T> try_dequeue() {
+        std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots_[pos & kMask];
+            std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return std::nullopt; // Slot not yet filled for this lap: empty
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::optional<T> result(std::in_place, std::move(*slot->value()));
+        slot->value()->~T();
+        // Hand the slot to the producer of the next lap
+        slot->sequence.store(pos + Capacity, std::memory_order_release);
+        return result;
+    }
+
+    /**
+     * @brief Checks if the queue is empty
+     *
+     * @note This is a snapshot and may be outdated immediately
+     * @return true if queue appears empty, false otherwise
+     */
+    bool empty() const noexcept {
+        return approximate_size() == 0;
+    }
+
+    /**
+     * @brief Gets the approximate number of elements
+     *
+     * @return Number of claimed slots not yet dequeued (snapshot)
+     */
+    std::size_t approximate_size() const noexcept {
+        std::size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+        std::size_t head = dequeue_pos_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    /**
+     * @brief Gets the fixed capacity
+     *
+     * @return Number of slots
+     */
+    static constexpr std::size_t capacity() noexcept {
+        return Capacity;
+    }
+};
+
+} // namespace concurrent
@@ -0,0 +1,345 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace concurrent {
+
+/**
+ * @brief Single-producer single-consumer queue of variable-length byte messages
+ *
+ * Messages are stored back to back in one byte ring, each behind an 8-byte
+ * length header and padded to 8 bytes. The producer reserves a contiguous
+ * region, writes the message in place and commits it; the consumer reads it
+ * as a span straight out of the ring and releases it. Nothing is allocated or
+ * copied by the queue itself.
+ *
+ * A message never wraps around the end of the ring: if it does not fit in
+ * the bytes left before the end, a skip marker fills them and the message
+ * starts at offset 0. As in SpscQueue, each side caches the other side's
+ * position and only reads the shared one when the ring looks full or empty.
+ */
+class ByteRingQueue {
+private:
+    static constexpr std::size_t kCacheLine = 64;
+    static constexpr std::size_t kAlign = 8;
+    static constexpr std::size_t kHeader = sizeof(std::uint64_t);
+    static constexpr std::uint64_t kSkip = ~std::uint64_t{0}; // Rest of the lap is padding
+
+    static std::size_t record_size(std::size_t payload) noexcept {
+        return kHeader + ((payload + kAlign - 1) & ~(kAlign - 1));
+    }
+
+    static std::size_t round_up_pow2(std::size_t n) noexcept {
+        std::size_t capacity = 64;
+        while (capacity < n) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+public:
+    /**
+     * @brief Space reserved by the producer, committed to make it visible
+     *
+     * Obtained from reserve(); empty (false) if the ring had no room.
+     * Dropping an uncommitted reservation abandons it.
+     */
+    class WriteReservation {
+    public:
+        WriteReservation() = default;
+
+        WriteReservation(WriteReservation&& other) noexcept
+            : queue_(std::exchange(other.queue_, nullptr)), data_(other.data_), size_(other.size_) {}
+
+        WriteReservation& operator=(WriteReservation&& other) noexcept {
+            queue_ = std::exchange(other.queue_, nullptr);
+            data_ = other.data_;
+            size_ = other.size_;
+            return *this;
+        }
+
+        explicit operator bool() const noexcept {
+            return queue_ != nullptr;
+        }
+
+        std::byte* data() const noexcept {
+            return data_;
+        }
+
+        std::size_t size() const noexcept {
+            return size_;
+        }
+
+        std::span<std::byte> span() const noexcept {
+            return {data_, size_};
+        }
+
+        /**
+         * @brief Publishes the first @p used bytes as one message
+         *
+         * @param used Message length, at most size()
+         */
+        void commit(std::size_t used) noexcept {
+            std::exchange(queue_, nullptr)->commit(used);
+        }
+
+        /**
+         * @brief Publishes the whole reservation as one message
+         */
+        void commit() noexcept {
+            commit(size_);
+        }
+
+    private:
+        friend class ByteRingQueue;
+
+        WriteReservation(ByteRingQueue* queue, std::byte* data, std::size_t size) noexcept
+            : queue_(queue), data_(data), size_(size) {}
+
+        ByteRingQueue* queue_ = nullptr;
+        std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    /**
+     * @brief The consumer's view of the oldest message, released when done
+     *
+     * Obtained from read(); empty (false) if the ring was empty. The bytes
+     * stay valid until release().
+     */
+    class ReadView {
+    public:
+        ReadView() = default;
+
+        ReadView(ReadView&& other) noexcept
+            : queue_(std::exchange(other.queue_, nullptr)), data_(other.data_),
+              size_(other.size_), next_(other.next_) {}
+
+        ReadView& operator=(ReadView&& other) noexcept {
+            queue_ = std::exchange(other.queue_, nullptr);
+            data_ = other.data_;
+            size_ = other.size_;
+            next_ = other.next_;
+            return *this;
+        }
+
+        explicit operator bool() const noexcept {
+            return queue_ != nullptr;
+        }
+
+        const std::byte* data() const noexcept {
+            return data_;
+        }
+
+        std::size_t size() const noexcept {
+            return size_;
+        }
+
+        std::span<const std::byte> span() const noexcept {
+            return {data_, size_};
+        }
+
+        /**
+         * @brief Frees the message's space for the producer
+         */
+        void release() noexcept {
+            std::exchange(queue_, nullptr)->head_.store(next_, std::memory_order_release);
+        }
+
+    private:
+        friend class ByteRingQueue;
+
+        ReadView(ByteRingQueue* queue, const std::byte* data, std::size_t size,
+                 std::size_t next) noexcept
+            : queue_(queue), data_(data), size_(size), next_(next) {}
+
+        ByteRingQueue* queue_ = nullptr;
+        const std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+        std::size_t next_ = 0; // Head position after this message
+    };
+
+    /**
+     * @brief Constructs an empty queue
+     *
+     * @param capacity Ring size in bytes; rounded up to a power of two (at least 64)
+     */
+    explicit ByteRingQueue(std::size_t capacity = 64 * 1024)
+        : capacity_(round_up_pow2(capacity)),
+          mask_(capacity_ - 1),
+          storage_(new std::uint64_t[capacity_ / sizeof(std::uint64_t)]),
+          buffer_(reinterpret_cast<std::byte*>(storage_.get())) {}
+
+    // Non-copyable, non-movable
+    ByteRingQueue(const ByteRingQueue&) = delete;
+    ByteRingQueue& operator=(const ByteRingQueue&) = delete;
+    ByteRingQueue(ByteRingQueue&&) = delete;
+    ByteRingQueue& operator=(ByteRingQueue&&) = delete;
+
+    /**
+     * @brief Reserves @p size contiguous bytes for the next message (producer only)
+     *
+     * Only one reservation may be outstanding at a time.
+     *
+     * @param size Message length, at most max_message_size()
+     * @return Reservation to write into and commit; empty if the ring is too full
+     */
+    WriteReservation reserve(std::size_t size) noexcept {
+        // Checked before rounding: a size near SIZE_MAX would wrap to a small record
+        if (size > max_message_size()) {
+            return {};
+        }
+        const std::size_t record = record_size(size);
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        std::size_t to_end = capacity_ - (tail & mask_);
+        if (record > to_end) {
+            // Pad out the lap; the message starts at offset 0 instead. The
+            // marker is published on its own so that the consumer can skip
+            // it and free the space even if this reservation fails
+            if (free_bytes(tail, to_end) < to_end) {
+                return {};
+            }
+            write_header(tail, kSkip);
+            tail += to_end;
+            tail_.store(tail, std::memory_order_release);
+        }
+        if (free_bytes(tail, record) < record) {
+            return {};
+        }
+        return WriteReservation(this, buffer_ + (tail & mask_) + kHeader, size);
+    }
+
+    /**
+     * @brief Copies a message into the ring (producer only)
+     *
+     * @param data Message bytes
+     * @param size Message length
+     * @return true if written, false if the ring is too full
+     */
+    bool try_write(const void* data, std::size_t size) noexcept {
+        WriteReservation reservation = reserve(size);
+        if (!reservation) {
+            return false;
+        }
+        std::memcpy(reservation.data(), data, size);
+        reservation.commit();
+        return true;
+    }
+
+    /**
+     * @brief Gets the oldest message without copying it (consumer only)
+     *
+     * @return View of the message; empty if the queue is empty
+     */
+    ReadView read() noexcept {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        while (true) {
+            if (filled_bytes(head) == 0) {
+                return {};
+            }
+            std::uint64_t length;
+            std::memcpy(&length, buffer_ + (head & mask_), kHeader);
+            if (length == kSkip) {
+                head += capacity_ - (head & mask_);
+                head_.store(head, std::memory_order_release);
+                continue;
+            }
+            auto size = static_cast<std::size_t>(length);
+            return ReadView(this, buffer_ + (head & mask_) + kHeader, size,
+                            head + record_size(size));
+        }
+    }
+
+    /**
+     * @brief Hands the oldest message to @p fn and releases it (consumer only)
+     *
+     * @param fn Callable invoked as fn(std::span<const std::byte>)
+     * @return true if a message was consumed, false if the queue is empty
+     */
+    template<typename F>
+    bool try_read(F&& fn) {
+        ReadView view = read();
+        if (!view) {
+            return false;
+        }
+        fn(view.span());
+        view.release();
+        return true;
+    }
+
+    /**
+     * @brief Checks if the queue is empty
+     *
+     * @note This is a snapshot and may be outdated immediately
+     * @return true if queue appears empty, false otherwise
+     */
+    bool empty() const noexcept {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Gets the ring size in bytes
+     */
+    std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief Gets the longest message that can ever be reserved
+     */
+    std::size_t max_message_size() const noexcept {
+        return capacity_ - kHeader;
+    }
+
+private:
+    void write_header(std::size_t position, std::uint64_t length) noexcept {
+        std::memcpy(buffer_ + (position & mask_), &length, kHeader);
+    }
+
+    // Any skip marker was already published by reserve(), so the tail is
+    // where the reserved record starts
+    void commit(std::size_t size) noexcept {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        write_header(tail, size);
+        tail_.store(tail + record_size(size), std::memory_order_release);
+    }
+
+    // Free bytes visible to the producer, refreshing the cached head if needed
+    std::size_t free_bytes(std::size_t tail, std::size_t wanted) noexcept {
+        std::size_t free = capacity_ - (tail - cached_head_);
+        if (free < wanted) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            free = capacity_ - (tail - cached_head_);
+        }
+        return free;
+    }
+
+    // Committed bytes visible to the consumer, refreshing the cached tail if empty
+    std::size_t filled_bytes(std::size_t head) noexcept {
+        if (cached_tail_ == head) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+        }
+        return cached_tail_ - head;
+    }
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<std::uint64_t[]> storage_; // 8-byte aligned backing store
+    std::byte* const buffer_;
+
+    // Producer line: written only by the producer
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};
+    std::size_t cached_head_ = 0;
+
+    // Consumer line: written only by the consumer
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};
+    std::size_t cached_tail_ = 0;
+};
+
+} // namespace concurrent
@@ -0,0 +1,362 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace concurrent {
+
+/**
+ * @brief Whether a Disruptor is fed by one producer thread or several
+ */
+enum class ProducerType {
+    kSingle, // Claims are plain increments, publication one release store
+    kMulti,  // Claims use fetch_add, publication is tracked per slot
+};
+
+/**
+ * @brief Multicast ring buffer with per-consumer cursors (LMAX Disruptor)
+ *
+ * Events live in a preallocated ring and are written in place: a producer
+ * claims one or more sequence numbers, fills the slots and publishes them.
+ * Every consumer reads every event through its own cursor, so fanning an
+ * event out to N consumers costs one write rather than N copies. A consumer
+ * may depend on other consumers and then only sees an event after they have
+ * released it, which forms processing pipelines (B runs after A) on the same
+ * slots. Producers wait for the slowest consumer before reusing a slot.
+ *
+ * Consumers read as many events as are available in one go and release them
+ * with a single store, so batching comes for free under load.
+ *
+ * Consumers must be added before the first claim. Waits spin briefly and
+ * then yield.
+ *
+ * @tparam T Event type (default constructible; slots are reused, not rebuilt)
+ * @tparam Producers Single or multiple producer threads
+ */
+template<typename T, ProducerType Producers = ProducerType::kSingle>
+class Disruptor {
+    static_assert(std::is_default_constructible_v<T>, "T must be default constructible");
+
+private:
+    static constexpr int kSpinTries = 64;
+
+    struct alignas(64) Cursor {
+        std::atomic<std::int64_t> value{-1};
+    };
+
+    // Spins, then yields, until ready() holds
+    template<typename Ready>
+    static void wait_until(Ready ready) {
+        for (int i = 0; !ready(); ++i) {
+            if (i >= kSpinTries) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief A consumer's view of the ring: its cursor and its dependencies
+     *
+     * Obtained from add_consumer() and used by one thread at a time.
+     */
+    class Consumer {
+    public:
+        /**
+         * @brief Gets the highest sequence this consumer may read right now
+         *
+         * @return Highest readable sequence; below next() if nothing is ready
+         */
+        std::int64_t available() const noexcept {
+            std::int64_t limit = ring_.published_from(next());
+            for (const Consumer* dependency : dependencies_) {
+                limit = std::min(limit, dependency->sequence());
+            }
+            return limit;
+        }
+
+        /**
+         * @brief Waits until @p sequence can be read
+         *
+         * @param sequence Sequence to wait for, usually next()
+         * @return Highest readable sequence, at least @p sequence
+         */
+        std::int64_t wait_for(std::int64_t sequence) const {
+            std::int64_t limit = available();
+            wait_until([&] { return (limit = available()) >= sequence; });
+            return limit;
+        }
+
+        /**
+         * @brief Marks every event up to @p sequence as processed
+         *
+         * Producers may then reuse those slots once every other consumer has
+         * released them too, and dependent consumers may read them.
+         *
+         * @param sequence Last processed sequence
+         */
+        void release(std::int64_t sequence) noexcept {
+            cursor_.value.store(sequence, std::memory_order_release);
+        }
+
+        /**
+         * @brief Gets the last released sequence (-1 before the first)
+         */
+        std::int64_t sequence() const noexcept {
+            return cursor_.value.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Gets the next sequence this consumer will read
+         */
+        std::int64_t next() const noexcept {
+            return cursor_.value.load(std::memory_order_relaxed) + 1;
+        }
+
+        /**
+         * @brief Handles every event that is ready now, then releases them at once
+         *
+         * @param fn Callable invoked as fn(T& event, std::int64_t sequence)
+         * @return Number of events handled
+         */
+        template<typename F>
+        std::size_t poll(F&& fn) {
+            std::int64_t first = next();
+            std::int64_t last = available();
+            for (std::int64_t sequence = first; sequence <= last; ++sequence) {
+                fn(ring_[sequence], sequence);
+            }
+            if (last >= first) {
+                release(last);
+                return static_cast<std::size_t>(last - first + 1);
+            }
+            return 0;
+        }
+
+        // Use Disruptor::add_consumer()
+        Consumer(const Disruptor& ring, std::initializer_list<const Consumer*> dependencies)
+            : ring_(ring), dependencies_(dependencies) {}
+
+        Consumer(const Consumer&) = delete;
+        Consumer& operator=(const Consumer&) = delete;
+
+    private:
+        Cursor cursor_;
+        const Disruptor& ring_;
+        std::vector<const Consumer*> dependencies_;
+    };
+
+    /**
+     * @brief Constructs a ring with every event default constructed
+     *
+     * @param capacity Number of slots; rounded up to a power of two
+     */
+    explicit Disruptor(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        capacity_ = static_cast<std::int64_t>(size);
+        mask_ = capacity_ - 1;
+        events_.reset(new T[size]);
+        if constexpr (Producers == ProducerType::kMulti) {
+            published_.reset(new std::atomic<std::int64_t>[size]);
+            for (std::size_t i = 0; i < size; ++i) {
+                published_[i].store(-1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Non-copyable, non-movable
+    Disruptor(const Disruptor&) = delete;
+    Disruptor& operator=(const Disruptor&) = delete;
+    Disruptor(Disruptor&&) = delete;
+    Disruptor& operator=(Disruptor&&) = delete;
+
+    /**
+     * @brief Registers a consumer that reads every event
+     *
+     * Not thread-safe, and only allowed before the first claim.
+     *
+     * @param dependencies Consumers that must release an event before this
+     *        one may read it; empty to read straight after publication
+     * @return The consumer, valid for the lifetime of the ring
+     */
+    Consumer& add_consumer(std::initializer_list<const Consumer*> dependencies = {}) {
+        return consumers_.emplace_back(*this, dependencies);
+    }
+
+    /**
+     * @brief Claims @p count consecutive sequences, waiting for free slots
+     *
+     * @param count Number of sequences; at most capacity()
+     * @return First claimed sequence; fill it and the following slots, then publish
+     */
+    std::int64_t claim(std::size_t count = 1) {
+        auto n = static_cast<std::int64_t>(count);
+        std::int64_t first;
+        if constexpr (Producers == ProducerType::kSingle) {
+            first = next_claim_;
+            next_claim_ += n;
+        } else {
+            first = claimed_.value.fetch_add(n, std::memory_order_relaxed) + 1;
+        }
+        std::int64_t wrap_point = first + n - 1 - capacity_;
+        if (wrap_point > gating_cache_.load(std::memory_order_acquire)) {
+            std::int64_t gating = minimum_consumer();
+            wait_until([&] { return (gating = minimum_consumer()) >= wrap_point; });
+            advance_gating_cache(gating);
+        }
+        return first;
+    }
+
+    /**
+     * @brief Claims @p count consecutive sequences if the slots are free
+     *
+     * @param count Number of sequences; at most capacity()
+     * @return First claimed sequence, empty if the slowest consumer is too far behind
+     */
+    std::optional<std::int64_t> try_claim(std::size_t count = 1) {
+        auto n = static_cast<std::int64_t>(count);
+        if constexpr (Producers == ProducerType::kSingle) {
+            if (!has_room(next_claim_ + n - 1)) {
+                return std::nullopt;
+            }
+            std::int64_t first = next_claim_;
+            next_claim_ += n;
+            return first;
+        } else {
+            std::int64_t last = claimed_.value.load(std::memory_order_relaxed);
+            do {
+                if (!has_room(last + n)) {
+                    return std::nullopt;
+                }
+            } while (!claimed_.value.compare_exchange_weak(last, last + n,
+                                                           std::memory_order_relaxed));
+            return last + 1;
+        }
+    }
+
+    /**
+     * @brief Makes claimed sequences visible to consumers
+     *
+     * With a single producer, sequences must be published in claim order.
+     *
+     * @param first First sequence returned by claim()
+     * @param count Number of sequences to publish
+     */
+    void publish(std::int64_t first, std::size_t count = 1) noexcept {
+        std::int64_t last = first + static_cast<std::int64_t>(count) - 1;
+        if constexpr (Producers == ProducerType::kSingle) {
+            published_cursor_.value.store(last, std::memory_order_release);
+        } else {
+            // Each slot records the sequence it holds, so consumers can tell
+            // a finished slot from one whose producer is still writing
+            for (std::int64_t sequence = first; sequence <= last; ++sequence) {
+                published_[sequence & mask_].store(sequence, std::memory_order_release);
+            }
+        }
+    }
+
+    /**
+     * @brief Claims one slot, fills it in place and publishes it
+     *
+     * @param fill Callable invoked as fill(T& event, std::int64_t sequence)
+     * @return The published sequence
+     */
+    template<typename F>
+    std::int64_t publish_event(F&& fill) {
+        std::int64_t sequence = claim();
+        fill((*this)[sequence], sequence);
+        publish(sequence);
+        return sequence;
+    }
+
+    /**
+     * @brief Accesses the slot holding @p sequence
+     *
+     * Only the producer that claimed the sequence (before publishing) or a
+     * consumer that may read it (after) should touch the slot.
+     */
+    T& operator[](std::int64_t sequence) const noexcept {
+        return events_[sequence & mask_];
+    }
+
+    /**
+     * @brief Gets the number of slots
+     */
+    std::size_t capacity() const noexcept {
+        return static_cast<std::size_t>(capacity_);
+    }
+
+private:
+    // Highest sequence published contiguously starting at from, or from - 1
+    std::int64_t published_from(std::int64_t from) const noexcept {
+        if constexpr (Producers == ProducerType::kSingle) {
+            return published_cursor_.value.load(std::memory_order_acquire);
+        } else {
+            std::int64_t claimed = claimed_.value.load(std::memory_order_acquire);
+            std::int64_t sequence = from;
+            while (sequence <= claimed &&
+                   published_[sequence & mask_].load(std::memory_order_acquire) == sequence) {
+                ++sequence;
+            }
+            return sequence - 1;
+        }
+    }
+
+    // Slowest consumer; without consumers nothing gates the producers
+    std::int64_t minimum_consumer() const noexcept {
+        std::int64_t minimum = std::numeric_limits<std::int64_t>::max();
+        for (const Consumer& consumer : consumers_) {
+            minimum = std::min(minimum, consumer.sequence());
+        }
+        return minimum;
+    }
+
+    bool has_room(std::int64_t last) {
+        std::int64_t wrap_point = last - capacity_;
+        if (wrap_point <= gating_cache_.load(std::memory_order_acquire)) {
+            return true;
+        }
+        std::int64_t gating = minimum_consumer();
+        advance_gating_cache(gating);
+        return gating >= wrap_point;
+    }
+
+    // The cache is shared by producers, so a producer passing the wrap check
+    // on another's cached value must still see the consumers' releases: the
+    // cache is published with release and read with acquire, and only moves
+    // forward, so a stale producer cannot hide a newer value
+    void advance_gating_cache(std::int64_t gating) noexcept {
+        std::int64_t cached = gating_cache_.load(std::memory_order_relaxed);
+        while (cached < gating &&
+               !gating_cache_.compare_exchange_weak(cached, gating, std::memory_order_release,
+                                                    std::memory_order_relaxed)) {
+        }
+    }
+
+    std::unique_ptr<T[]> events_;
+    std::unique_ptr<std::atomic<std::int64_t>[]> published_; // Multi-producer only
+    std::int64_t capacity_ = 0;
+    std::int64_t mask_ = 0;
+    std::deque<Consumer> consumers_; // Stable addresses for dependencies
+
+    Cursor published_cursor_; // Single producer: last published sequence
+    Cursor claimed_;          // Multi-producer: last claimed sequence
+    std::int64_t next_claim_ = 0; // Single producer only
+    // Slowest consumer as last seen by a producer
+    alignas(64) std::atomic<std::int64_t> gating_cache_{-1};
+};
+
+} // namespace concurrent
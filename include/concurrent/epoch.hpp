@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace concurrent {
+
+/**
+ * @brief Epoch-based memory reclamation (EBR)
+ *
+ * Lock-free structures cannot free a node as soon as it is unlinked, because
+ * other threads may still be traversing it. EBR solves this by having every
+ * operation run inside a Guard that pins the calling thread to the current
+ * global epoch. Unlinked nodes are retired into a per-thread limbo list tagged
+ * with that epoch and are only freed once the global epoch has advanced far
+ * enough that no pinned thread can still hold a reference.
+ *
+ * The domain is process-wide: each thread lazily acquires a record on first
+ * use and releases it on exit, leaving any unreclaimed limbo entries to the
+ * next thread that picks the record up. It is the default Reclaimer policy of
+ * the containers; HazardPointerDomain offers the same interface.
+ */
+class EpochDomain {
+public:
+    using Deleter = void (*)(void*);
+
+    // A pinned thread keeps every node it could reach alive, so traversals
+    // need not re-validate their position after each step
+    static constexpr bool kGuardProtectsAll = true;
+
+    /**
+     * @brief RAII pin of the calling thread to the current epoch
+     *
+     * Guards nest: only the outermost guard announces and clears the epoch.
+     */
+    class Guard {
+    public:
+        Guard() noexcept {
+            EpochDomain::enter();
+        }
+
+        ~Guard() {
+            EpochDomain::leave();
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        Guard(Guard&&) = delete;
+        Guard& operator=(Guard&&) = delete;
+
+        /**
+         * @brief Loads a shared pointer; the pin already keeps it alive
+         *
+         * Provided so containers can be written once against either domain.
+         */
+        template<typename T>
+        T* protect(std::size_t /*slot*/, const std::atomic<T*>& src) const noexcept {
+            return src.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief No-op counterpart of HazardPointerDomain::Guard::announce
+         */
+        void announce(std::size_t /*slot*/, const void* /*ptr*/) const noexcept {}
+    };
+
+    /**
+     * @brief Retires an object that has been unlinked from a shared structure
+     *
+     * The object is destroyed with @p deleter once no thread pinned at the
+     * time of retirement can still reach it.
+     *
+     * @param ptr Object to reclaim
+     * @param deleter Function releasing the object
+     */
+    static void retire(void* ptr, Deleter deleter);
+
+    /**
+     * @brief Retires an object allocated with new
+     *
+     * @tparam T Object type
+     * @param ptr Object to delete once safe
+     */
+    template<typename T>
+    static void retire(T* ptr) {
+        retire(static_cast<void*>(ptr), [](void* p) { delete static_cast<T*>(p); });
+    }
+
+    /**
+     * @brief Tries to advance the global epoch and frees the calling thread's
+     *        limbo entries that have become safe
+     */
+    static void collect();
+
+    /**
+     * @brief Gets the current global epoch
+     *
+     * @return Global epoch counter (monotonically increasing)
+     */
+    static std::uint64_t epoch() noexcept;
+
+private:
+    static void enter() noexcept;
+    static void leave() noexcept;
+};
+
+} // namespace concurrent
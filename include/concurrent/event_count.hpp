@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace concurrent {
+
+/**
+ * @brief Lets threads sleep until a lock-free condition may have changed
+ *
+ * A waiter first registers with prepare_wait(), then re-checks its condition
+ * and either calls cancel_wait() or sleeps in wait()/wait_until(). A notifier
+ * changes the state the condition depends on and then calls notify_one() or
+ * notify_all(), which only enter the kernel if a waiter is registered.
+ *
+ * No wakeup is lost as long as the notifier's state change and the waiter's
+ * re-check are both sequentially consistent operations (a seq_cst RMW on the
+ * notifier side, a seq_cst load on the waiter side): either the waiter sees
+ * the change, or the notifier sees the registration.
+ *
+ * On Linux the wait word is a futex; elsewhere std::atomic::wait is used.
+ */
+class EventCount {
+public:
+    using Key = std::uint32_t;
+
+    EventCount() = default;
+
+    EventCount(const EventCount&) = delete;
+    EventCount& operator=(const EventCount&) = delete;
+
+    /**
+     * @brief Registers the calling thread as a waiter
+     *
+     * Must be followed by exactly one of cancel_wait(), wait() or wait_until().
+     *
+     * @return Key identifying the notifications seen so far
+     */
+    Key prepare_wait() noexcept {
+        Key key = epoch_.load(std::memory_order_acquire);
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        return key;
+    }
+
+    /**
+     * @brief Unregisters a waiter whose condition turned out to be satisfied
+     */
+    void cancel_wait() noexcept {
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Sleeps until a notification newer than @p key arrives
+     *
+     * @param key Value returned by prepare_wait()
+     */
+    void wait(Key key) noexcept;
+
+    /**
+     * @brief Sleeps until a notification newer than @p key arrives or the deadline passes
+     *
+     * @param key Value returned by prepare_wait()
+     * @param deadline Absolute timeout
+     * @return true if notified, false on timeout
+     */
+    bool wait_until(Key key, std::chrono::steady_clock::time_point deadline) noexcept;
+
+    /**
+     * @brief Wakes one registered waiter, if any
+     */
+    void notify_one() noexcept {
+        if (waiters_.load(std::memory_order_seq_cst) != 0) {
+            wake(false);
+        }
+    }
+
+    /**
+     * @brief Wakes all registered waiters, if any
+     */
+    void notify_all() noexcept {
+        if (waiters_.load(std::memory_order_seq_cst) != 0) {
+            wake(true);
+        }
+    }
+
+private:
+    void wake(bool all) noexcept;
+
+    std::atomic<Key> epoch_{0};
+    std::atomic<std::uint32_t> waiters_{0};
+};
+
+} // namespace concurrent
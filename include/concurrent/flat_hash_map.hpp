@@ -0,0 +1,701 @@
+#pragma once
+
+#include "epoch.hpp"
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CONCURRENT_FLAT_MAP_SSE2 1
+#endif
+
+namespace concurrent {
+
+/**
+ * @brief Concurrent open-addressing hash map with SIMD group probing
+ *
+ * Keys and values are stored inline in groups of 16 slots. Each group also
+ * holds 16 control bytes, in the style of Swiss tables: a full slot stores
+ * 7 bits of its key's hash, and the high bit marks a slot as empty or
+ * deleted. A lookup hashes to a home group and compares all 16 tags at once
+ * (one SSE2 compare). It only looks at the slots whose tag matches, and
+ * probes further groups until it reaches one with an empty slot. A hit
+ * usually costs one cache miss, instead of a bucket head, a node and a
+ * value pointer.
+ *
+ * Concurrency:
+ * - Every group has a seqlock that writers hold while they change it.
+ * - If the key and value can be copied with lock-free atomics (integers,
+ *   pointers, small trivially copyable structs), readers never write
+ *   shared memory. They copy what they need and retry if the version moved.
+ * - Other types (e.g. std::string) are read under a per-group reader count,
+ *   and writers wait for it to drain.
+ * - A writer also holds its key's home-group lock for the whole operation.
+ *   Only one thread at a time can insert, update or erase a given key, so a
+ *   key can never be inserted twice.
+ * - An erase leaves a tombstone unless the group still has an empty slot,
+ *   and inserts reuse tombstones.
+ * - When occupancy passes 7/8 (tombstones included), the table is rebuilt.
+ *   It doubles in size, or keeps its size if it is mostly tombstones.
+ *   Entries are copied, so readers still on the old table see it intact.
+ *   The old table is freed through EpochDomain.
+ *
+ * @tparam Key The key type (must be hashable and equality comparable)
+ * @tparam Value The value type
+ * @tparam Hash The hash function type (defaults to std::hash<Key>)
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class FlatConcurrentHashMap {
+private:
+    static constexpr std::size_t kGroupSize = 16;
+    static constexpr std::size_t DEFAULT_CAPACITY = 128;
+
+    // Full slots hold a 7-bit tag; free slots have the high bit set
+    static constexpr std::int8_t kEmpty = -128;  // 0x80
+    static constexpr std::int8_t kDeleted = -2;  // 0xFE
+    static constexpr std::uint64_t kEmptyWord = 0x8080808080808080ULL;
+
+    template<typename T>
+    static constexpr bool lock_free_copyable() {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            return std::atomic_ref<T>::is_always_lock_free;
+        } else {
+            return false;
+        }
+    }
+
+    template<typename T>
+    static constexpr std::size_t slot_alignment() {
+        if constexpr (lock_free_copyable<T>()) {
+            return std::atomic_ref<T>::required_alignment;
+        } else {
+            return alignof(T);
+        }
+    }
+
+    // Optimistic readers may copy an entry while a writer changes it, so both
+    // sides go through atomic_ref; that needs lock-free copies of key and value
+    static constexpr bool kOptimisticReads = lock_free_copyable<Key>() &&
+                                             lock_free_copyable<Value>();
+
+    struct Slot {
+        union { alignas(slot_alignment<Key>()) Key key; };
+        union { alignas(slot_alignment<Value>()) Value value; };
+
+        Slot() {}
+        ~Slot() {}
+    };
+
+    struct alignas(64) Group {
+        std::atomic<std::uint32_t> version{0};  // Seqlock: odd while a writer changes the group
+        std::atomic<std::uint32_t> readers{0};  // Readers that do not validate optimistically
+        std::atomic<bool> home_lock{false};     // Held by writers of keys whose probe starts here
+        std::atomic<std::uint64_t> ctrl[2] = {kEmptyWord, kEmptyWord};
+        Slot slots[kGroupSize];
+    };
+
+    struct Table {
+        std::unique_ptr<Group[]> groups;
+        std::size_t group_mask;
+        std::size_t growth_limit;
+        std::atomic<std::size_t> used{0}; // Full slots plus tombstones
+
+        explicit Table(std::size_t group_count)
+            : groups(new Group[group_count]),
+              group_mask(group_count - 1),
+              growth_limit(group_count * kGroupSize * 7 / 8) {}
+
+        ~Table() {
+            if constexpr (!std::is_trivially_destructible_v<Key> ||
+                          !std::is_trivially_destructible_v<Value>) {
+                for (std::size_t g = 0; g <= group_mask; ++g) {
+                    Group& group = groups[g];
+                    for (std::uint32_t full = load_ctrl(group).match_full(); full;
+                         full &= full - 1) {
+                        destroy_entry(group.slots[std::countr_zero(full)]);
+                    }
+                }
+            }
+        }
+    };
+
+    // Snapshot of a group's control bytes; bit i of each mask is slot i
+    struct ControlBytes {
+        std::uint64_t lo;
+        std::uint64_t hi;
+
+        std::int8_t at(std::size_t i) const noexcept {
+            return static_cast<std::int8_t>((i < 8 ? lo : hi) >> ((i % 8) * 8));
+        }
+
+        std::uint32_t match(std::int8_t tag) const noexcept {
+#if defined(CONCURRENT_FLAT_MAP_SSE2)
+            __m128i ctrl = _mm_set_epi64x(static_cast<long long>(hi), static_cast<long long>(lo));
+            return static_cast<std::uint32_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(tag))));
+#else
+            std::uint32_t mask = 0;
+            for (std::size_t i = 0; i < kGroupSize; ++i) {
+                mask |= static_cast<std::uint32_t>(at(i) == tag) << i;
+            }
+            return mask;
+#endif
+        }
+
+        std::uint32_t match_free() const noexcept {
+#if defined(CONCURRENT_FLAT_MAP_SSE2)
+            __m128i ctrl = _mm_set_epi64x(static_cast<long long>(hi), static_cast<long long>(lo));
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl));
+#else
+            std::uint32_t mask = 0;
+            for (std::size_t i = 0; i < kGroupSize; ++i) {
+                mask |= static_cast<std::uint32_t>(at(i) < 0) << i;
+            }
+            return mask;
+#endif
+        }
+
+        std::uint32_t match_empty() const noexcept { return match(kEmpty); }
+        std::uint32_t match_full() const noexcept { return ~match_free() & 0xFFFFu; }
+    };
+
+    // Where a key's probe sequence starts, and its tag
+    struct HashedKey {
+        std::size_t group;
+        std::int8_t tag;
+    };
+
+    // What one group holds for a key
+    struct GroupScan {
+        int slot = -1;          // Slot holding the key, or -1
+        bool has_empty = false; // An empty slot ends the probe sequence
+        bool has_free = false;  // An insert could use an empty or deleted slot
+    };
+
+    enum class InsertResult { Inserted, Updated, Grow };
+
+    std::atomic<Table*> table_;
+    std::atomic<std::size_t> size_{0};
+    std::mutex resize_mutex_;
+    Hash hasher_;
+
+    static ControlBytes load_ctrl(const Group& group) noexcept {
+        return {group.ctrl[0].load(std::memory_order_relaxed),
+                group.ctrl[1].load(std::memory_order_relaxed)};
+    }
+
+    static void set_ctrl(Group& group, std::size_t i, std::int8_t ctrl) noexcept {
+        std::atomic<std::uint64_t>& word = group.ctrl[i / 8];
+        const unsigned shift = static_cast<unsigned>(i % 8) * 8;
+        std::uint64_t bits = word.load(std::memory_order_relaxed);
+        bits = (bits & ~(std::uint64_t{0xFF} << shift)) |
+               (std::uint64_t{static_cast<std::uint8_t>(ctrl)} << shift);
+        word.store(bits, std::memory_order_relaxed);
+    }
+
+    static bool key_equals(Slot& slot, const Key& key) {
+        if constexpr (kOptimisticReads) {
+            return std::atomic_ref<Key>(slot.key).load(std::memory_order_relaxed) == key;
+        } else {
+            return slot.key == key;
+        }
+    }
+
+    static Value load_value(Slot& slot) {
+        if constexpr (kOptimisticReads) {
+            return std::atomic_ref<Value>(slot.value).load(std::memory_order_relaxed);
+        } else {
+            return slot.value;
+        }
+    }
+
+    static void store_entry(Slot& slot, const Key& key, const Value& value) {
+        if constexpr (kOptimisticReads) {
+            std::atomic_ref<Key>(slot.key).store(key, std::memory_order_relaxed);
+            std::atomic_ref<Value>(slot.value).store(value, std::memory_order_relaxed);
+        } else {
+            new (&slot.key) Key(key);
+            try {
+                new (&slot.value) Value(value);
+            } catch (...) {
+                slot.key.~Key();
+                throw;
+            }
+        }
+    }
+
+    static void assign_value(Slot& slot, Value&& value) {
+        if constexpr (kOptimisticReads) {
+            std::atomic_ref<Value>(slot.value).store(value, std::memory_order_relaxed);
+        } else {
+            slot.value = std::move(value);
+        }
+    }
+
+    static void destroy_entry(Slot& slot) noexcept {
+        slot.key.~Key();
+        slot.value.~Value();
+    }
+
+    static void reclaim_table(void* table) {
+        delete static_cast<Table*>(table);
+    }
+
+    // Multiplying and folding keeps identity hashes (std::hash<int>) from
+    // putting runs of consecutive keys in the same group
+    HashedKey hash_key(const Key& key, const Table& table) const {
+        std::uint64_t h = static_cast<std::uint64_t>(hasher_(key)) * 0x9E3779B97F4A7C15ULL;
+        h ^= h >> 32;
+        return {static_cast<std::size_t>(h >> 7) & table.group_mask,
+                static_cast<std::int8_t>(h & 0x7F)};
+    }
+
+    // Triangular steps visit every group when the count is a power of two
+    static std::size_t next_group(std::size_t group, std::size_t step,
+                                  const Table& table) noexcept {
+        return (group + step) & table.group_mask;
+    }
+
+    /**
+     * @brief Runs a read of one group against a state no writer is changing
+     *
+     * Optimistic reads may run more than once and must not have side effects
+     * beyond their result.
+     */
+    template<typename F>
+    static auto read_group(Group& group, F&& read) {
+        if constexpr (kOptimisticReads) {
+            while (true) {
+                std::uint32_t version = group.version.load(std::memory_order_acquire);
+                if (version & 1) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                auto result = read(group);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (group.version.load(std::memory_order_relaxed) == version) {
+                    return result;
+                }
+            }
+        } else {
+            // Pairs with lock_group: either the writer sees this reader or
+            // the reader sees the writer's odd version
+            while (true) {
+                group.readers.fetch_add(1, std::memory_order_seq_cst);
+                if ((group.version.load(std::memory_order_seq_cst) & 1) == 0) {
+                    break;
+                }
+                group.readers.fetch_sub(1, std::memory_order_release);
+                while (group.version.load(std::memory_order_relaxed) & 1) {
+                    std::this_thread::yield();
+                }
+            }
+            struct Exit {
+                Group& group;
+                ~Exit() { group.readers.fetch_sub(1, std::memory_order_release); }
+            } exit{group};
+            return read(group);
+        }
+    }
+
+    static void lock_group(Group& group) noexcept {
+        std::uint32_t version = group.version.load(std::memory_order_relaxed);
+        while ((version & 1) ||
+               !group.version.compare_exchange_weak(version, version + 1,
+                                                    std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed)) {
+            std::this_thread::yield();
+            version = group.version.load(std::memory_order_relaxed);
+        }
+        // Entry and control writes must not become visible before the odd version
+        std::atomic_thread_fence(std::memory_order_release);
+        if constexpr (!kOptimisticReads) {
+            while (group.readers.load(std::memory_order_seq_cst) != 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    static void unlock_group(Group& group) noexcept {
+        group.version.fetch_add(1, std::memory_order_release);
+    }
+
+    static void lock_home(Group& group) noexcept {
+        while (group.home_lock.exchange(true, std::memory_order_acquire)) {
+            while (group.home_lock.load(std::memory_order_relaxed)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    static void unlock_home(Group& group) noexcept {
+        group.home_lock.store(false, std::memory_order_release);
+    }
+
+    static GroupScan scan(Group& group, const Key& key, std::int8_t tag) {
+        return read_group(group, [&](Group& g) {
+            ControlBytes ctrl = load_ctrl(g);
+            GroupScan result;
+            for (std::uint32_t match = ctrl.match(tag); match; match &= match - 1) {
+                int i = std::countr_zero(match);
+                if (key_equals(g.slots[i], key)) {
+                    result.slot = i;
+                    break;
+                }
+            }
+            result.has_empty = ctrl.match_empty() != 0;
+            result.has_free = ctrl.match_free() != 0;
+            return result;
+        });
+    }
+
+    // Caller holds the home-group lock, so no other thread writes this key
+    InsertResult insert_locked(Table& table, HashedKey hashed, const Key& key,
+                               const Value& value) {
+        std::size_t group = hashed.group;
+        std::size_t step = 1;
+        std::size_t free_group = 0;
+        std::size_t free_step = 0;
+        bool have_free = false;
+
+        for (;; group = next_group(group, step, table), ++step) {
+            GroupScan found = scan(table.groups[group], key, hashed.tag);
+            if (found.slot >= 0) {
+                Group& g = table.groups[group];
+                // Copy outside the group lock so only a move can throw inside it
+                Value staged(value);
+                lock_group(g);
+                try {
+                    assign_value(g.slots[found.slot], std::move(staged));
+                } catch (...) {
+                    unlock_group(g);
+                    throw;
+                }
+                unlock_group(g);
+                return InsertResult::Updated;
+            }
+            if (found.has_free && !have_free) {
+                free_group = group;
+                free_step = step;
+                have_free = true;
+            }
+            if (found.has_empty) {
+                break;
+            }
+        }
+
+        // Reserve occupancy up front; handed back if a tombstone is reused
+        if (table.used.fetch_add(1, std::memory_order_relaxed) >= table.growth_limit) {
+            table.used.fetch_sub(1, std::memory_order_relaxed);
+            return InsertResult::Grow;
+        }
+
+        // Another key may have taken the free slot since the scan; empty slots
+        // never reappear in a full group, so probing on stays correct
+        for (group = free_group, step = free_step;; group = next_group(group, step, table), ++step) {
+            Group& g = table.groups[group];
+            lock_group(g);
+            ControlBytes ctrl = load_ctrl(g);
+            if (std::uint32_t free = ctrl.match_free()) {
+                int i = std::countr_zero(free);
+                bool reused = ctrl.at(static_cast<std::size_t>(i)) == kDeleted;
+                try {
+                    store_entry(g.slots[i], key, value);
+                } catch (...) {
+                    unlock_group(g);
+                    table.used.fetch_sub(1, std::memory_order_relaxed);
+                    throw;
+                }
+                set_ctrl(g, static_cast<std::size_t>(i), hashed.tag);
+                unlock_group(g);
+                if (reused) {
+                    table.used.fetch_sub(1, std::memory_order_relaxed);
+                }
+                return InsertResult::Inserted;
+            }
+            unlock_group(g);
+        }
+    }
+
+    // Caller holds the home-group lock
+    bool erase_locked(Table& table, HashedKey hashed, const Key& key) {
+        std::size_t group = hashed.group;
+        for (std::size_t step = 1;; group = next_group(group, step, table), ++step) {
+            GroupScan found = scan(table.groups[group], key, hashed.tag);
+            if (found.slot >= 0) {
+                Group& g = table.groups[group];
+                lock_group(g);
+                destroy_entry(g.slots[found.slot]);
+                // A probe passing a group with an empty slot stops there
+                // anyway, so the slot can go back to empty without a tombstone
+                bool to_empty = load_ctrl(g).match_empty() != 0;
+                set_ctrl(g, static_cast<std::size_t>(found.slot), to_empty ? kEmpty : kDeleted);
+                unlock_group(g);
+                if (to_empty) {
+                    table.used.fetch_sub(1, std::memory_order_relaxed);
+                }
+                return true;
+            }
+            if (found.has_empty) {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * @brief Replaces a full table with a rebuilt one
+     *
+     * Takes every home-group lock, so no writer is active on the old table.
+     * Writers that were waiting for one of them see the new table and retry.
+     * If copying an entry throws, the locks are released and the old table
+     * stays in place.
+     */
+    void grow(Table* table) {
+        std::lock_guard<std::mutex> lock(resize_mutex_);
+        if (table_.load(std::memory_order_acquire) != table) {
+            return; // Someone else already grew it
+        }
+        const std::size_t group_count = table->group_mask + 1;
+
+        // Mostly tombstones: rebuilding at the same size purges them. Either
+        // size holds every entry the old table can have, so the new table is
+        // allocated before any writer is locked out
+        const std::size_t live = size_.load(std::memory_order_relaxed);
+        auto fresh = std::make_unique<Table>(live * 2 >= table->growth_limit ? group_count * 2
+                                                                             : group_count);
+
+        for (std::size_t g = 0; g < group_count; ++g) {
+            lock_home(table->groups[g]);
+        }
+        auto unlock_all = [&]() noexcept {
+            for (std::size_t g = 0; g < group_count; ++g) {
+                unlock_home(table->groups[g]);
+            }
+        };
+        try {
+            for (std::size_t g = 0; g < group_count; ++g) {
+                Group& group = table->groups[g];
+                for (std::uint32_t full = load_ctrl(group).match_full(); full; full &= full - 1) {
+                    Slot& slot = group.slots[std::countr_zero(full)];
+                    place(*fresh, slot.key, slot.value);
+                }
+            }
+        } catch (...) {
+            unlock_all(); // fresh destroys the entries copied so far
+            throw;
+        }
+
+        table_.store(fresh.release(), std::memory_order_release);
+        unlock_all();
+        EpochDomain::retire(table, &reclaim_table);
+    }
+
+    // Inserts a key known to be absent into a table nobody else can see yet
+    void place(Table& table, const Key& key, const Value& value) {
+        HashedKey hashed = hash_key(key, table);
+        std::size_t group = hashed.group;
+        for (std::size_t step = 1;; group = next_group(group, step, table), ++step) {
+            Group& g = table.groups[group];
+            if (std::uint32_t free = load_ctrl(g).match_free()) {
+                std::size_t i = static_cast<std::size_t>(std::countr_zero(free));
+                store_entry(g.slots[i], key, value);
+                set_ctrl(g, i, hashed.tag);
+                table.used.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    static std::size_t groups_for(std::size_t capacity) noexcept {
+        // Room for capacity elements below the 7/8 growth limit
+        std::size_t groups = (capacity * 8 / 7 + kGroupSize - 1) / kGroupSize;
+        return std::bit_ceil(groups < 1 ? std::size_t{1} : groups);
+    }
+
+public:
+    /**
+     * @brief Constructs an empty map
+     *
+     * @param capacity Number of elements to make room for before the first
+     *        resize (default: 128)
+     * @param hash Hash function instance
+     */
+    explicit FlatConcurrentHashMap(std::size_t capacity = DEFAULT_CAPACITY, Hash hash = Hash())
+        : table_(new Table(groups_for(capacity))), hasher_(std::move(hash)) {}
+
+    /**
+     * @brief Destructor - not thread-safe, no concurrent operations allowed
+     */
+    ~FlatConcurrentHashMap() {
+        delete table_.load(std::memory_order_relaxed);
+    }
+
+    // Non-copyable, non-movable
+    FlatConcurrentHashMap(const FlatConcurrentHashMap&) = delete;
+    FlatConcurrentHashMap& operator=(const FlatConcurrentHashMap&) = delete;
+    FlatConcurrentHashMap(FlatConcurrentHashMap&&) = delete;
+    FlatConcurrentHashMap& operator=(FlatConcurrentHashMap&&) = delete;
+
+    /**
+     * @brief Inserts or updates a key-value pair
+     *
+     * @param key The key
+     * @param value The value
+     * @return true if inserted, false if updated
+     */
+    bool insert(const Key& key, const Value& value) {
+        EpochDomain::Guard guard;
+        while (true) {
+            Table* table = table_.load(std::memory_order_acquire);
+            HashedKey hashed = hash_key(key, *table);
+            Group& home = table->groups[hashed.group];
+            lock_home(home);
+            if (table_.load(std::memory_order_acquire) != table) {
+                unlock_home(home); // Resized while waiting
+                continue;
+            }
+
+            InsertResult result;
+            try {
+                result = insert_locked(*table, hashed, key, value);
+            } catch (...) {
+                unlock_home(home);
+                throw;
+            }
+            if (result == InsertResult::Inserted) {
+                // Counted before the home lock is released, so a resize sees it
+                size_.fetch_add(1, std::memory_order_relaxed);
+            }
+            unlock_home(home);
+
+            if (result == InsertResult::Grow) {
+                grow(table);
+                continue;
+            }
+            return result == InsertResult::Inserted;
+        }
+    }
+
+    /**
+     * @brief Retrieves a value by key
+     *
+     * @param key The key to look up
+     * @return std::optional<Value> containing the value if found
+     */
+    std::optional<Value> get(const Key& key) const {
+        EpochDomain::Guard guard;
+        Table* table = table_.load(std::memory_order_acquire);
+        HashedKey hashed = hash_key(key, *table);
+        std::size_t group = hashed.group;
+
+        for (std::size_t step = 1;; group = next_group(group, step, *table), ++step) {
+            struct Lookup {
+                std::optional<Value> value;
+                bool has_empty;
+            };
+            Lookup found = read_group(table->groups[group], [&](Group& g) {
+                ControlBytes ctrl = load_ctrl(g);
+                Lookup result{std::nullopt, ctrl.match_empty() != 0};
+                for (std::uint32_t match = ctrl.match(hashed.tag); match; match &= match - 1) {
+                    Slot& slot = g.slots[std::countr_zero(match)];
+                    if (key_equals(slot, key)) {
+                        result.value = load_value(slot);
+                        break;
+                    }
+                }
+                return result;
+            });
+            if (found.value || found.has_empty) {
+                return std::move(found.value);
+            }
+        }
+    }
+
+    /**
+     * @brief Removes a key-value pair
+     *
+     * @param key The key to remove
+     * @return true if removed, false if not found
+     */
+    bool erase(const Key& key) {
+        EpochDomain::Guard guard;
+        while (true) {
+            Table* table = table_.load(std::memory_order_acquire);
+            HashedKey hashed = hash_key(key, *table);
+            Group& home = table->groups[hashed.group];
+            lock_home(home);
+            if (table_.load(std::memory_order_acquire) != table) {
+                unlock_home(home);
+                continue;
+            }
+            bool erased = erase_locked(*table, hashed, key);
+            if (erased) {
+                size_.fetch_sub(1, std::memory_order_relaxed);
+            }
+            unlock_home(home);
+            return erased;
+        }
+    }
+
+    /**
+     * @brief Checks if a key exists
+     *
+     * @param key The key to check
+     * @return true if key exists, false otherwise
+     */
+    bool contains(const Key& key) const {
+        EpochDomain::Guard guard;
+        Table* table = table_.load(std::memory_order_acquire);
+        HashedKey hashed = hash_key(key, *table);
+        std::size_t group = hashed.group;
+        for (std::size_t step = 1;; group = next_group(group, step, *table), ++step) {
+            GroupScan found = scan(table->groups[group], key, hashed.tag);
+            if (found.slot >= 0) {
+                return true;
+            }
+            if (found.has_empty) {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * @brief Gets the approximate size
+     *
+     * @return Approximate number of elements
+     */
+    std::size_t size() const noexcept {
+        return size_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Checks if the map is empty
+     *
+     * @return true if empty, false otherwise
+     */
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Gets the number of slots in the current table
+     *
+     * @return Slot count (a multiple of 16); at most 7/8 of it is ever occupied
+     */
+    std::size_t capacity() const {
+        EpochDomain::Guard guard;
+        return (table_.load(std::memory_order_acquire)->group_mask + 1) * kGroupSize;
+    }
+};
+
+} // namespace concurrent
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace concurrent {
+
+namespace detail {
+
+// wyhash's default secret
+inline constexpr std::uint64_t kHashSecret[4] = {
+    0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+
+// Full 64x64 -> 128 bit product with the halves folded together
+inline std::uint64_t mum(std::uint64_t a, std::uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128;
+    uint128 product = static_cast<uint128>(a) * b;
+    return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    std::uint64_t high;
+    std::uint64_t low = _umul128(a, b, &high);
+    return low ^ high;
+#else
+    std::uint64_t a_lo = a & 0xFFFFFFFFULL, a_hi = a >> 32;
+    std::uint64_t b_lo = b & 0xFFFFFFFFULL, b_hi = b >> 32;
+    std::uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo;
+    std::uint64_t lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+    std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFULL) + lo_hi;
+    std::uint64_t high = hi_hi + (hi_lo >> 32) + (cross >> 32);
+    std::uint64_t low = (cross << 32) | (lo_lo & 0xFFFFFFFFULL);
+    return low ^ high;
+#endif
+}
+
+inline std::uint64_t read64(const unsigned char* p) noexcept {
+    std::uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline std::uint64_t read32(const unsigned char* p) noexcept {
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+} // namespace detail
+
+/**
+ * @brief Mixes a 64-bit value so that every input bit affects the low bits
+ *
+ * Two 128-bit multiplies: a handful of cycles, where a division by a prime
+ * bucket count costs 20-40. One is not enough: the low half of a single
+ * product ignores the high bits of x, so strided keys would still cluster.
+ */
+inline std::uint64_t mix64(std::uint64_t x) noexcept {
+    using detail::kHashSecret;
+    return detail::mum(detail::mum(x ^ kHashSecret[0], kHashSecret[1]), kHashSecret[2]);
+}
+
+/**
+ * @brief Hashes a byte string, wyhash style
+ *
+ * Reads 16 bytes per round and finishes the tail with two overlapping loads,
+ * so short keys take no loop at all.
+ */
+inline std::uint64_t hash_bytes(const void* data, std::size_t len) noexcept {
+    using detail::kHashSecret;
+    const auto* p = static_cast<const unsigned char*>(data);
+    std::uint64_t seed = kHashSecret[0] ^ detail::mum(len ^ kHashSecret[1], kHashSecret[2]);
+    std::size_t remaining = len;
+
+    while (remaining > 16) {
+        seed = detail::mum(detail::read64(p) ^ kHashSecret[1], detail::read64(p + 8) ^ seed);
+        p += 16;
+        remaining -= 16;
+    }
+
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
+    if (remaining >= 8) {
+        a = detail::read64(p);
+        b = detail::read64(p + remaining - 8);
+    } else if (remaining >= 4) {
+        a = detail::read32(p);
+        b = detail::read32(p + remaining - 4);
+    } else if (remaining > 0) {
+        a = (std::uint64_t{p[0]} << 16) | (std::uint64_t{p[remaining >> 1]} << 8) |
+            p[remaining - 1];
+    }
+    return detail::mum(detail::mum(a ^ kHashSecret[1], b ^ seed),
+                       static_cast<std::uint64_t>(len) ^ kHashSecret[3]);
+}
+
+/**
+ * @brief Default hasher for tables that index buckets by masking low bits
+ *
+ * std::hash is the identity for integers, so with a power-of-two table keys
+ * that differ only in their high bits (strided ids, aligned pointers) share
+ * a bucket. MixHash spreads every key over all 64 bits:
+ * - integers, enums and pointers are mixed with mix64
+ * - anything convertible to std::string_view is hashed with hash_bytes
+ * - other types get mix64 applied to their std::hash
+ *
+ * @tparam Key The key type
+ */
+template<typename Key>
+struct MixHash {
+    std::size_t operator()(const Key& key) const noexcept(
+        std::is_integral_v<Key> || std::is_enum_v<Key> || std::is_pointer_v<Key> ||
+        std::is_nothrow_convertible_v<const Key&, std::string_view>) {
+        if constexpr (std::is_integral_v<Key> || std::is_enum_v<Key>) {
+            return static_cast<std::size_t>(mix64(static_cast<std::uint64_t>(key)));
+        } else if constexpr (std::is_pointer_v<Key>) {
+            // Before the string case: const char* keys compare by address
+            return static_cast<std::size_t>(
+                mix64(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(key))));
+        } else if constexpr (std::is_convertible_v<const Key&, std::string_view>) {
+            std::string_view bytes = key;
+            return static_cast<std::size_t>(hash_bytes(bytes.data(), bytes.size()));
+        } else {
+            return static_cast<std::size_t>(
+                mix64(static_cast<std::uint64_t>(std::hash<Key>{}(key))));
+        }
+    }
+};
+
+} // namespace concurrent
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace concurrent {
+
+/**
+ * @brief Hazard-pointer memory reclamation
+ *
+ * Each thread owns a small array of hazard slots. Before dereferencing a
+ * shared node, a thread announces it in a slot and re-validates that the node
+ * is still reachable; a retired node is only freed once no slot announces it.
+ * Retired nodes are kept in a per-thread list that is scanned against all
+ * announced hazards once it exceeds a threshold proportional to the total
+ * number of slots, which bounds unreclaimed memory and amortizes the scan.
+ *
+ * Like EpochDomain, the domain is process-wide and can be used as the
+ * Reclaimer policy of LockFreeQueue and LockFreeHashMap.
+ */
+class HazardPointerDomain {
+public:
+    using Deleter = void (*)(void*);
+
+    // Only announced pointers are protected; traversals must re-validate
+    static constexpr bool kGuardProtectsAll = false;
+
+    // Slots available to a single Guard (enough for list traversal)
+    static constexpr std::size_t kSlotsPerGuard = 3;
+
+    // Slots per thread record block, allowing guards to nest; deeper nesting
+    // chains on further blocks
+    static constexpr std::size_t kSlotsPerRecord = 4 * kSlotsPerGuard;
+
+    /**
+     * @brief RAII owner of kSlotsPerGuard hazard slots of the calling thread
+     *
+     * Slots are cleared when the guard is destroyed. Guards must be destroyed
+     * in reverse order of construction.
+     */
+    class Guard {
+    public:
+        Guard() noexcept : slots_(HazardPointerDomain::acquire_slots()) {}
+
+        ~Guard() {
+            HazardPointerDomain::release_slots(slots_);
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        Guard(Guard&&) = delete;
+        Guard& operator=(Guard&&) = delete;
+
+        /**
+         * @brief Loads a pointer and keeps it alive until the slot is reused
+         *
+         * @param slot Slot index in [0, kSlotsPerGuard)
+         * @param src Shared location to read
+         * @return Pointer that is safe to dereference while announced
+         */
+        template<typename T>
+        T* protect(std::size_t slot, const std::atomic<T*>& src) noexcept {
+            T* ptr = src.load(std::memory_order_relaxed);
+            while (true) {
+                announce(slot, ptr);
+                T* current = src.load(std::memory_order_acquire);
+                if (current == ptr) {
+                    return ptr;
+                }
+                ptr = current;
+            }
+        }
+
+        /**
+         * @brief Announces a pointer the caller will validate itself
+         *
+         * @param slot Slot index in [0, kSlotsPerGuard)
+         * @param ptr Pointer to protect (must not carry mark bits)
+         */
+        void announce(std::size_t slot, const void* ptr) noexcept {
+            slots_[slot].store(ptr, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+    private:
+        std::atomic<const void*>* slots_;
+    };
+
+    /**
+     * @brief Retires an object that has been unlinked from a shared structure
+     *
+     * @param ptr Object to reclaim
+     * @param deleter Function releasing the object
+     */
+    static void retire(void* ptr, Deleter deleter);
+
+    /**
+     * @brief Retires an object allocated with new
+     *
+     * @tparam T Object type
+     * @param ptr Object to delete once no hazard slot announces it
+     */
+    template<typename T>
+    static void retire(T* ptr) {
+        retire(static_cast<void*>(ptr), [](void* p) { delete static_cast<T*>(p); });
+    }
+
+    /**
+     * @brief Scans the calling thread's retired list immediately
+     */
+    static void collect();
+
+private:
+    static std::atomic<const void*>* acquire_slots() noexcept;
+    static void release_slots(std::atomic<const void*>* slots) noexcept;
+};
+
+} // namespace concurrent
@@ -1,11 +1,18 @@
 #pragma once
 
+#include "epoch.hpp"
+#include "hash.hpp"
+#include <array>
 #include <atomic>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <optional>
-#include <vector>
+#include <type_traits>
+#include <utility>
 
 namespace concurrent {
 
@@ -15,68 +22,577 @@ namespace concurrent {
  * This is a high-performance, thread-safe hash map that uses fine-grained
  * locking with atomic operations for lock-free reads and lock-free writes
  * in most cases. Designed for high-concurrency scenarios.
+ *
+ * The table resizes itself with Shalev-Shavit split-ordered lists: every
+ * element lives in one lock-free list sorted by its bit-reversed hash, and a
+ * bucket is just a pointer to a sentinel node inside that list. Reversing
+ * the bits keeps the elements of bucket b together, and doubling the bucket
+ * count splits each bucket in two at a point that is already in the list.
+ * Growing therefore only bumps the bucket count; a new bucket inserts its
+ * sentinel after its parent's on first use, and no element ever moves.
+ *
+ * Bucket counts are powers of two, so a key's bucket is the low bits of its
+ * hash rather than a division. That needs a hash whose low bits depend on
+ * the whole key, which MixHash provides and std::hash<int> does not.
  * 
  * @tparam Key The key type (must be hashable and equality comparable)
  * @tparam Value The value type
- * @tparam Hash The hash function type (defaults to std::hash<Key>)
+ * @tparam Hash The hash function type (defaults to MixHash<Key>)
+ * @tparam Reclaimer Memory reclamation policy for erased nodes
+ *         (EpochDomain or HazardPointerDomain)
  */
-template<typename Key, typename Value, typename Hash = std::hash<Key>>
+template<typename Key, typename Value, typename Hash = MixHash<Key>,
+         typename Reclaimer = EpochDomain>
 class LockFreeHashMap {
 private:
-    struct Node {
+    // The list is a Harris-Michael list: the low bit of a node's next pointer
+    // marks the node itself as logically deleted, so a deleted node can no
+    // longer be linked past and traversals can validate what they read.
+    struct NodeBase {
+        std::atomic<NodeBase*> next{nullptr};
+        const std::uint64_t order; // Split-order key: odd for elements, even for sentinels
+
+        explicit NodeBase(std::uint64_t o) : order(o) {}
+    };
+
+    static constexpr bool value_fits_word() {
+        if constexpr (std::is_trivially_copyable_v<Value> &&
+                      std::is_default_constructible_v<Value>) {
+            return sizeof(Value) < sizeof(std::uint64_t) &&
+                   std::atomic<std::uint64_t>::is_always_lock_free;
+        } else {
+            return false;
+        }
+    }
+
+    // Values smaller than a word live in the node, packed into one atomic word
+    // with a flag byte, and are overwritten in place. Larger ones live out of
+    // line: an update swaps in a new copy and retires the old one, so a reader
+    // still copying it is never left dangling.
+    //
+    // Erase kills the value before unlinking the node: it sets the flag byte,
+    // or swaps in dead_value_tag_'s address. That is erase's linearization
+    // point, and it makes every later update of the node's value fail, so an
+    // update can never land on an erased node and be lost.
+    static constexpr bool kInlineValue = value_fits_word();
+    using SlotValue = std::conditional_t<kInlineValue, std::uint64_t, Value*>;
+    using ValueSlot = std::atomic<SlotValue>;
+
+    static constexpr std::uint64_t kDeadWord =
+        std::bit_cast<std::uint64_t>(std::array<unsigned char, 8>{0, 0, 0, 0, 0, 0, 0, 1});
+    alignas(Value) static inline unsigned char dead_value_tag_ = 0;
+
+    // Tags the Node constructor that takes over an already built value
+    struct AdoptValue {};
+
+    struct Node : NodeBase {
         Key key;
-        std::atomic<Value*> value;
-        std::atomic<Node*> next{nullptr};
-        std::atomic<bool> marked{false}; // For safe deletion
+        ValueSlot value;
+
+        template<typename... Args>
+        Node(std::uint64_t order, const Key& k, Args&&... args)
+            : NodeBase(order), key(k), value(make_value(std::forward<Args>(args)...)) {}
 
-        Node(const Key& k, const Value& v) 
-            : key(k), value(new Value(v)) {}
+        Node(std::uint64_t order, const Key& k, AdoptValue, SlotValue v)
+            : NodeBase(order), key(k), value(v) {}
+
+        // Hands the value of a node that was never linked back to the caller
+        SlotValue take_value() noexcept {
+            if constexpr (kInlineValue) {
+                return value.load(std::memory_order_relaxed);
+            } else {
+                return value.exchange(nullptr, std::memory_order_relaxed);
+            }
+        }
         
         ~Node() {
-            Value* val = value.load();
-            if (val) {
-                delete val;
+            if constexpr (!kInlineValue) {
+                Value* v = value.load(std::memory_order_relaxed);
+                if (v != dead_value()) {
+                    delete v;
+                }
             }
         }
     };
 
-    struct Bucket {
-        alignas(64) std::atomic<Node*> head{nullptr};
+    // A bucket holds its sentinel node, or null until first used
+    using Bucket = std::atomic<NodeBase*>;
+
+    // Where a lookup ended: the link pointing at curr, curr itself and its successor
+    struct Position {
+        std::atomic<NodeBase*>* prev;
+        NodeBase* curr;
+        NodeBase* next;
+        std::size_t spare_slot; // Guard slot protecting neither curr nor next
     };
 
+    using Guard = typename Reclaimer::Guard;
+
     static constexpr size_t DEFAULT_BUCKET_COUNT = 1024;
     static constexpr double LOAD_FACTOR_THRESHOLD = 0.75;
 
-    std::vector<Bucket> buckets_;
+    // Bucket b lives in segment bit_width(b) - 1 (buckets 0 and 1 in segment
+    // 0), so segments double in size and existing ones never move
+    static constexpr int kMaxSegments = 48;
+    static constexpr size_t kMaxBuckets = size_t{1} << kMaxSegments;
+
+    mutable std::atomic<Bucket*> segments_[kMaxSegments] = {};
+    std::atomic<size_t> bucket_count_; // Power of two
     std::atomic<size_t> size_{0};
     Hash hasher_;
 
-    size_t bucket_index(const Key& key) const {
-        return hasher_(key) % buckets_.size();
+    static bool is_marked(NodeBase* ptr) noexcept {
+        return (reinterpret_cast<std::uintptr_t>(ptr) & 1) != 0;
     }
 
-    Node* find_node(const Bucket& bucket, const Key& key) const {
-        Node* current = bucket.head.load(std::memory_order_acquire);
-        while (current) {
-            if (!current->marked.load(std::memory_order_acquire) && 
-                current->key == key) {
-                return current;
+    static NodeBase* marked(NodeBase* ptr) noexcept {
+        return reinterpret_cast<NodeBase*>(reinterpret_cast<std::uintptr_t>(ptr) | 1);
+    }
+
+    static NodeBase* unmarked(NodeBase* ptr) noexcept {
+        return reinterpret_cast<NodeBase*>(reinterpret_cast<std::uintptr_t>(ptr) &
+                                           ~std::uintptr_t(1));
+    }
+
+    static bool is_element(const NodeBase* node) noexcept {
+        return (node->order & 1) != 0;
+    }
+
+    // Only elements are ever retired; sentinels live as long as the map
+    static void reclaim_node(void* node) {
+        delete static_cast<Node*>(static_cast<NodeBase*>(node));
+    }
+
+    // Stands in for the value of an erased node; never dereferenced
+    static Value* dead_value() noexcept {
+        return reinterpret_cast<Value*>(&dead_value_tag_);
+    }
+
+    static std::uint64_t pack(const Value& value) noexcept {
+        std::array<unsigned char, 8> bytes{};
+        std::memcpy(bytes.data(), &value, sizeof(Value));
+        return std::bit_cast<std::uint64_t>(bytes);
+    }
+
+    static Value unpack(std::uint64_t word) noexcept {
+        auto bytes = std::bit_cast<std::array<unsigned char, 8>>(word);
+        Value value;
+        std::memcpy(&value, bytes.data(), sizeof(Value));
+        return value;
+    }
+
+    static bool is_dead(std::uint64_t word) noexcept {
+        return (word & kDeadWord) != 0;
+    }
+
+    template<typename... Args>
+    static auto make_value(Args&&... args) {
+        if constexpr (kInlineValue) {
+            return pack(Value(std::forward<Args>(args)...));
+        } else {
+            return new Value(std::forward<Args>(args)...);
+        }
+    }
+
+    static bool is_killed(SlotValue value) noexcept {
+        if constexpr (kInlineValue) {
+            return is_dead(value);
+        } else {
+            return value == dead_value();
+        }
+    }
+
+    static bool is_live(Node* node) noexcept {
+        return !is_killed(node->value.load(std::memory_order_acquire));
+    }
+
+    // A value built before it is known whether it goes into a new node or
+    // replaces an existing node's; owned here until stored
+    class PendingValue {
+    public:
+        template<typename V>
+        explicit PendingValue(V&& value) : value_(make_value(std::forward<V>(value))) {}
+
+        ~PendingValue() {
+            if constexpr (!kInlineValue) {
+                delete value_;
+            }
+        }
+
+        PendingValue(const PendingValue&) = delete;
+        PendingValue& operator=(const PendingValue&) = delete;
+
+        SlotValue get() const noexcept { return value_; }
+
+        SlotValue release() noexcept {
+            SlotValue value = value_;
+            if constexpr (!kInlineValue) {
+                value_ = nullptr;
+            }
+            return value;
+        }
+
+        void reset(SlotValue value) noexcept {
+            if constexpr (!kInlineValue) {
+                delete value_;
+            }
+            value_ = value;
+        }
+
+    private:
+        SlotValue value_;
+    };
+
+    // Erases the node's value; false if another erase got there first
+    static bool kill_value(Node* node) {
+        if constexpr (kInlineValue) {
+            return !is_dead(node->value.fetch_or(kDeadWord, std::memory_order_acq_rel));
+        } else {
+            Value* old = node->value.exchange(dead_value(), std::memory_order_acq_rel);
+            if (old == dead_value()) {
+                return false;
+            }
+            Reclaimer::retire(old);
+            return true;
+        }
+    }
+
+    // Sets the deletion mark on a node's next pointer, whoever killed its value
+    static void mark_deleted(NodeBase* node) noexcept {
+        NodeBase* next = node->next.load(std::memory_order_acquire);
+        while (!is_marked(next) &&
+               !node->next.compare_exchange_weak(next, marked(next), std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+        }
+    }
+
+    static std::uint64_t reverse_bits(std::uint64_t x) noexcept {
+        x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+        x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+        x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+        x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+        x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);
+        return (x >> 32) | (x << 32);
+    }
+
+    // The top bit becomes the low bit, so elements sort after their bucket's sentinel
+    static std::uint64_t element_order(size_t hash) noexcept {
+        return reverse_bits(static_cast<std::uint64_t>(hash) | (std::uint64_t{1} << 63));
+    }
+
+    static std::uint64_t sentinel_order(size_t bucket) noexcept {
+        return reverse_bits(static_cast<std::uint64_t>(bucket));
+    }
+
+    static size_t round_up_pow2(size_t n) noexcept {
+        size_t count = 1;
+        while (count < n && count < kMaxBuckets) {
+            count <<= 1;
+        }
+        return count;
+    }
+
+    Bucket& bucket_slot(size_t bucket) const {
+        int segment = bucket < 2 ? 0 : std::bit_width(bucket) - 1;
+        size_t first = segment == 0 ? 0 : size_t{1} << segment;
+        Bucket* buckets = segments_[segment].load(std::memory_order_acquire);
+        if (!buckets) {
+            size_t count = segment == 0 ? 2 : size_t{1} << segment;
+            auto* fresh = new Bucket[count](); // All null
+            if (segments_[segment].compare_exchange_strong(buckets, fresh,
+                                                           std::memory_order_acq_rel,
+                                                           std::memory_order_acquire)) {
+                buckets = fresh;
+            } else {
+                delete[] fresh;
+            }
+        }
+        return buckets[bucket - first];
+    }
+
+    // Sentinel of a bucket, linking it into the list on first use
+    NodeBase* bucket_sentinel(size_t bucket) const {
+        Bucket& slot = bucket_slot(bucket);
+        NodeBase* sentinel = slot.load(std::memory_order_acquire);
+        return sentinel ? sentinel : initialize_bucket(bucket, slot);
+    }
+
+    // The parent bucket (top bit cleared) covers every key of this one, so
+    // the sentinel goes into the list somewhere after the parent's sentinel
+    NodeBase* initialize_bucket(size_t bucket, Bucket& slot) const {
+        NodeBase* parent = bucket_sentinel(bucket & ~(size_t{1} << (std::bit_width(bucket) - 1)));
+        auto* sentinel = new NodeBase(sentinel_order(bucket));
+        {
+            Guard guard;
+            Position pos;
+            while (true) {
+                if (find(parent, sentinel->order, nullptr, guard, pos)) {
+                    // Another thread got there first; use its sentinel
+                    delete sentinel;
+                    sentinel = pos.curr;
+                    break;
+                }
+                sentinel->next.store(pos.curr, std::memory_order_relaxed);
+                NodeBase* expected = pos.curr;
+                if (pos.prev->compare_exchange_strong(expected, sentinel, std::memory_order_release,
+                                                      std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+        }
+        slot.store(sentinel, std::memory_order_release);
+        return sentinel;
+    }
+
+    NodeBase* sentinel_for(size_t hash) const {
+        return bucket_sentinel(hash & (bucket_count_.load(std::memory_order_acquire) - 1));
+    }
+
+    /**
+     * @brief Searches the list from a sentinel, unlinking deleted nodes on the way
+     *
+     * Uses all three guard slots, rotating them so that prev's node, curr and
+     * next stay announced without copying pointers between slots. Sentinels
+     * are never removed, so the search can always restart from start.
+     *
+     * @param key Key to match among elements of the given order; null to find a sentinel
+     * @return true if pos.curr is the node sought; otherwise pos.curr is the
+     *         first node ordered after it (or null) and pos.prev links to it
+     */
+    bool find(NodeBase* start, std::uint64_t order, const Key* key, Guard& guard,
+              Position& pos) const {
+    retry:
+        std::size_t prev_slot = 0;
+        std::size_t curr_slot = 1;
+        std::size_t next_slot = 2;
+
+        pos.prev = &start->next;
+        pos.curr = pos.prev->load(std::memory_order_acquire);
+        guard.announce(curr_slot, unmarked(pos.curr));
+        if (pos.prev->load(std::memory_order_acquire) != pos.curr) {
+            goto retry;
+        }
+        if (is_marked(pos.curr)) {
+            goto retry; // start is a sentinel and is never deleted
+        }
+
+        while (pos.curr) {
+            pos.next = pos.curr->next.load(std::memory_order_acquire);
+            guard.announce(next_slot, unmarked(pos.next));
+            // Validate that curr is still linked from an undeleted predecessor
+            // and that next is still its successor; both keep next alive
+            if (pos.curr->next.load(std::memory_order_acquire) != pos.next ||
+                pos.prev->load(std::memory_order_acquire) != pos.curr) {
+                goto retry;
+            }
+
+            if (is_marked(pos.next)) {
+                // curr is logically deleted - help unlink it
+                NodeBase* expected = pos.curr;
+                if (!pos.prev->compare_exchange_strong(expected, unmarked(pos.next),
+                                                       std::memory_order_acq_rel,
+                                                       std::memory_order_acquire)) {
+                    goto retry;
+                }
+                Reclaimer::retire(pos.curr, &reclaim_node);
+                pos.curr = unmarked(pos.next);
+                std::swap(curr_slot, next_slot);
+                continue;
+            }
+
+            if (pos.curr->order > order) {
+                return false;
+            }
+            if (pos.curr->order == order &&
+                (!key || static_cast<Node*>(pos.curr)->key == *key)) {
+                pos.spare_slot = prev_slot;
+                return true;
+            }
+
+            pos.prev = &pos.curr->next;
+            std::size_t free_slot = prev_slot;
+            prev_slot = curr_slot;
+            curr_slot = next_slot;
+            next_slot = free_slot;
+            pos.curr = pos.next;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Finds the live node of a key, linking a new one in if it is absent
+     *
+     * The new node is linked with a CAS on the link the search ended at, so
+     * it fails if any node was inserted or removed there meanwhile and the
+     * search runs again: two threads cannot both insert the same key. A node
+     * whose value erase has killed counts as absent; it is marked so that the
+     * next search unlinks it.
+     *
+     * @param spare Node built by an earlier call and never linked, used instead
+     *        of a new one; keeps the node built here if the key turns out present
+     * @param make_node Builds the node for a given split-order key; called only
+     *        if the key is absent and spare is empty
+     * @return The key's node (in pos.curr if found) and whether it was inserted
+     */
+    template<typename MakeNode>
+    std::pair<Node*, bool> find_or_insert(NodeBase* start, const Key& key, size_t hash,
+                                          Guard& guard, Position& pos,
+                                          std::unique_ptr<Node>& spare, MakeNode&& make_node) {
+        const std::uint64_t order = element_order(hash);
+
+        while (true) {
+            if (find(start, order, &key, guard, pos)) {
+                Node* node = static_cast<Node*>(pos.curr);
+                if (is_live(node)) {
+                    return {node, false};
+                }
+                mark_deleted(node);
+                continue;
+            }
+
+            // Link a new node in order; a failed CAS means the neighbourhood changed
+            if (!spare) {
+                spare.reset(make_node(order));
+            }
+            spare->next.store(pos.curr, std::memory_order_relaxed);
+            NodeBase* expected = pos.curr;
+            if (pos.prev->compare_exchange_weak(expected, spare.get(), std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+                maybe_grow(size_.fetch_add(1, std::memory_order_relaxed) + 1);
+                return {spare.release(), true};
+            }
+        }
+    }
+
+    /**
+     * @brief Replaces a node's value unless erase has killed it
+     *
+     * @param fresh Packed or out-of-line value; owned by the node on success,
+     *        still by the caller on failure
+     * @return false if the node has been erased
+     */
+    static bool store_value(Node* node, SlotValue fresh) {
+        SlotValue current = node->value.load(std::memory_order_acquire);
+        while (true) {
+            if (is_killed(current)) {
+                return false;
+            }
+            if (node->value.compare_exchange_weak(current, fresh, std::memory_order_acq_rel,
+                                                  std::memory_order_acquire)) {
+                if constexpr (!kInlineValue) {
+                    Reclaimer::retire(current);
+                }
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Replaces a node's value with fn(current) by compare-and-swap
+     *
+     * @tparam kReturnNew Whether to return the value stored or the one replaced
+     * @param slot Guard slot free to protect an out-of-line value
+     * @return std::nullopt, with nothing stored, if the node has been erased
+     */
+    template<bool kReturnNew, typename F>
+    static std::optional<Value> update_value(Node* node, Guard& guard, std::size_t slot,
+                                             F&& fn) {
+        if constexpr (kInlineValue) {
+            std::uint64_t current = node->value.load(std::memory_order_acquire);
+            while (true) {
+                if (is_dead(current)) {
+                    return std::nullopt;
+                }
+                Value previous = unpack(current);
+                Value next = fn(std::as_const(previous));
+                if (node->value.compare_exchange_weak(current, pack(next),
+                                                      std::memory_order_acq_rel,
+                                                      std::memory_order_acquire)) {
+                    return kReturnNew ? next : previous;
+                }
+            }
+        } else {
+            while (true) {
+                Value* current = guard.protect(slot, node->value);
+                if (current == dead_value()) {
+                    return std::nullopt;
+                }
+                // Once published, next can be replaced and freed by another
+                // writer, so everything returned is copied before the CAS
+                Value stored = fn(std::as_const(*current));
+                std::optional<Value> previous;
+                if constexpr (!kReturnNew) {
+                    previous.emplace(*current);
+                }
+                auto next = kReturnNew ? std::make_unique<Value>(stored)
+                                       : std::make_unique<Value>(std::move(stored));
+                Value* expected = current;
+                if (node->value.compare_exchange_strong(expected, next.get(),
+                                                        std::memory_order_acq_rel,
+                                                        std::memory_order_acquire)) {
+                    next.release();
+                    Reclaimer::retire(current);
+                    if constexpr (kReturnNew) {
+                        return stored;
+                    } else {
+                        return previous;
+                    }
+                }
             }
-            current = current->next.load(std::memory_order_acquire);
         }
-        return nullptr;
+    }
+
+    // Doubles the bucket count once the load factor is exceeded; the new
+    // buckets fill in lazily as they are used
+    void maybe_grow(size_t size) noexcept {
+        size_t buckets = bucket_count_.load(std::memory_order_relaxed);
+        if (static_cast<double>(size) > static_cast<double>(buckets) * LOAD_FACTOR_THRESHOLD &&
+            buckets < kMaxBuckets) {
+            bucket_count_.compare_exchange_strong(buckets, buckets * 2, std::memory_order_release,
+                                                  std::memory_order_relaxed);
+        }
     }
 
 public:
     /**
      * @brief Constructs a lock-free hash map
      * 
-     * @param bucket_count Initial number of buckets (default: 1024)
+     * @param bucket_count Initial number of buckets, rounded up to a power of
+     *        two (default: 1024); the table grows as elements are added
      * @param hash Hash function instance
      */
     explicit LockFreeHashMap(size_t bucket_count = DEFAULT_BUCKET_COUNT, 
                             Hash hash = Hash())
-        : buckets_(bucket_count), hasher_(std::move(hash)) {}
+        : bucket_count_(round_up_pow2(bucket_count)), hasher_(std::move(hash)) {
+        bucket_slot(0).store(new NodeBase(sentinel_order(0)), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Destructor - not thread-safe, no concurrent operations allowed
+     */
+    ~LockFreeHashMap() {
+        // Bucket 0's sentinel heads the whole list
+        NodeBase* current = segments_[0].load(std::memory_order_relaxed)[0].load(
+            std::memory_order_relaxed);
+        while (current) {
+            NodeBase* next = unmarked(current->next.load(std::memory_order_relaxed));
+            if (is_element(current)) {
+                delete static_cast<Node*>(current);
+            } else {
+                delete current;
+            }
+            current = next;
+        }
+        for (auto& segment : segments_) {
+            delete[] segment.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Non-copyable, non-movable
+    LockFreeHashMap(const LockFreeHashMap&) = delete;
+    LockFreeHashMap& operator=(const LockFreeHashMap&) = delete;
+    LockFreeHashMap(LockFreeHashMap&&) = delete;
+    LockFreeHashMap& operator=(LockFreeHashMap&&) = delete;
 
     /**
      * @brief Inserts or updates a key-value pair
@@ -86,33 +602,133 @@ public:
      * @return true if inserted, false if updated
      */
     bool insert(const Key& key, const Value& value) {
-        Bucket& bucket = buckets_[bucket_index(key)];
-        
-        // Check if key already exists
-        Node* existing = find_node(bucket, key);
-        if (existing) {
-            // Update existing value
-            Value* new_val = new Value(value);
-            Value* old_val = existing->value.exchange(new_val, std::memory_order_acq_rel);
-            delete old_val;
-            return false;
+        return insert_or_assign(key, value);
+    }
+
+    /**
+     * @brief Inserts a key-value pair, or assigns the value if the key exists
+     *
+     * @param key The key
+     * @param value The value
+     * @return true if inserted, false if assigned
+     */
+    template<typename V>
+    bool insert_or_assign(const Key& key, V&& value) {
+        const size_t hash = hasher_(key);
+        NodeBase* start = sentinel_for(hash);
+        Guard guard;
+        Position pos;
+        PendingValue fresh(std::forward<V>(value));
+        std::unique_ptr<Node> spare;
+
+        while (true) {
+            auto [node, inserted] = find_or_insert(start, key, hash, guard, pos, spare,
+                [&](std::uint64_t order) {
+                    auto* node = new Node(order, key, AdoptValue{}, fresh.get());
+                    fresh.release();
+                    return node;
+                });
+            if (inserted) {
+                return true;
+            }
+            // The value may already sit in a node that lost the race; take it back
+            if (spare) {
+                fresh.reset(spare->take_value());
+                spare.reset();
+            }
+            if (store_value(node, fresh.get())) {
+                fresh.release();
+                return false;
+            }
+            // Erased meanwhile; the next search unlinks it and inserts instead
         }
+    }
 
-        // Insert new node
-        Node* new_node = new Node(key, value);
-        Node* head = bucket.head.load(std::memory_order_acquire);
-        new_node->next.store(head, std::memory_order_relaxed);
+    /**
+     * @brief Inserts a value constructed from args if the key is absent
+     *
+     * Nothing is constructed, and args are left untouched, if the key exists
+     * when the call starts; a concurrent insert of the same key may still win
+     * after the value was built, in which case it is discarded.
+     *
+     * @param key The key
+     * @param args Arguments for the value's constructor
+     * @return true if inserted, false if the key already existed
+     */
+    template<typename... Args>
+    bool try_emplace(const Key& key, Args&&... args) {
+        const size_t hash = hasher_(key);
+        NodeBase* start = sentinel_for(hash);
+        Guard guard;
+        Position pos;
+        std::unique_ptr<Node> spare;
+        return find_or_insert(start, key, hash, guard, pos, spare, [&](std::uint64_t order) {
+            return new Node(order, key, std::forward<Args>(args)...);
+        }).second;
+    }
 
-        // Try to update head atomically
-        while (!bucket.head.compare_exchange_weak(
-            head, new_node, 
-            std::memory_order_release, 
-            std::memory_order_acquire)) {
-            new_node->next.store(head, std::memory_order_relaxed);
+    /**
+     * @brief Atomically sets the value of a key to fn(current value)
+     *
+     * fn receives std::nullopt if the key is absent, in which case its result
+     * is inserted. It may be called more than once when racing other writers,
+     * so it must not have side effects.
+     *
+     * @param key The key
+     * @param fn Callable taking const std::optional<Value>& and returning a Value
+     * @return The value stored
+     */
+    template<typename F>
+    Value compute(const Key& key, F&& fn) {
+        const size_t hash = hasher_(key);
+        NodeBase* start = sentinel_for(hash);
+        Guard guard;
+        Position pos;
+        std::optional<Value> created;
+        std::unique_ptr<Node> spare; // Holds *created while it is built but not linked
+
+        while (true) {
+            auto [node, inserted] = find_or_insert(start, key, hash, guard, pos, spare,
+                [&](std::uint64_t order) {
+                    created.emplace(fn(std::optional<Value>()));
+                    return new Node(order, key, *created);
+                });
+            if (inserted) {
+                return std::move(*created);
+            }
+            auto stored = update_value<true>(node, guard, pos.spare_slot,
+                                             [&](const Value& current) {
+                                                 return fn(std::optional<Value>(current));
+                                             });
+            if (stored) {
+                return std::move(*stored);
+            }
+            // Erased meanwhile; the next search unlinks it and inserts instead
         }
+    }
 
-        size_.fetch_add(1, std::memory_order_relaxed);
-        return true;
+    /**
+     * @brief Atomically replaces the value of an existing key with fn(value)
+     *
+     * Nothing is inserted if the key is absent. fn may be called more than
+     * once when racing other writers, so it must not have side effects.
+     *
+     * @param key The key
+     * @param fn Callable taking const Value& and returning the new Value
+     * @return The value replaced, or std::nullopt if the key was absent
+     */
+    template<typename F>
+    std::optional<Value> fetch_update(const Key& key, F&& fn) {
+        const size_t hash = hasher_(key);
+        NodeBase* start = sentinel_for(hash);
+        Guard guard;
+        Position pos;
+        if (!find(start, element_order(hash), &key, guard, pos)) {
+            return std::nullopt;
+        }
+        // std::nullopt too if an erase killed the value first
+        return update_value<false>(static_cast<Node*>(pos.curr), guard, pos.spare_slot,
+                                   std::forward<F>(fn));
     }
 
     /**
@@ -122,13 +738,24 @@ public:
      * @return std::optional<Value> containing the value if found
      */
     std::optional<Value> get(const Key& key) const {
-        const Bucket& bucket = buckets_[bucket_index(key)];
-        Node* node = find_node(bucket, key);
+        const size_t hash = hasher_(key);
+        NodeBase* start = sentinel_for(hash);
+        Guard guard;
+        Position pos;
         
-        if (node) {
-            Value* val = node->value.load(std::memory_order_acquire);
-            if (val) {
-                return *val;
+        if (find(start, element_order(hash), &key, guard, pos)) {
+            auto& slot = static_cast<Node*>(pos.curr)->value;
+            if constexpr (kInlineValue) {
+                std::uint64_t word = slot.load(std::memory_order_acquire);
+                if (!is_dead(word)) {
+                    return unpack(word);
+                }
+            } else {
+                // The node is protected, but the value can be replaced and retired
+                Value* value = guard.protect(pos.spare_slot, slot);
+                if (value != dead_value()) {
+                    return *value;
+                }
             }
         }
         return std::nullopt;
@@ -141,84 +768,37 @@ public:
      * @return true if removed, false if not found
      */
     bool erase(const Key& key) {
-        Bucket& bucket = buckets_[bucket_index(key)];
+        const size_t hash = hasher_(key);
+        const std::uint64_t order = element_order(hash);
+        NodeBase* start = sentinel_for(hash);
+        Guard guard;
+        Position pos;
         
-        // Retry loop for finding and removing the node
-        while (true) {
-            Node* node = find_node(bucket, key);
-            
-            if (!node) {
-                return false;
-            }
+        if (!find(start, order, &key, guard, pos)) {
+            return false;
+        }
 
-            // Mark node for deletion (prevents other threads from finding it)
-            bool was_marked = node->marked.exchange(true, std::memory_order_acq_rel);
-            if (was_marked) {
-                // Node was already marked by another thread, retry to find it again
-                // (it might have been removed already)
-                continue;
-            }
-            
-            // Successfully marked the node - we own it now
-            // Remove from chain
-            Node* head = bucket.head.load(std::memory_order_acquire);
-            if (head == node) {
-                // Node is at head - try to update head
-                Node* next = node->next.load(std::memory_order_acquire);
-                while (!bucket.head.compare_exchange_weak(
-                    head, next,
-                    std::memory_order_release,
-                    std::memory_order_acquire)) {
-                    if (head != node) {
-                        // Head changed to a different node - restart from beginning
-                        // (another thread might have removed our node or changed the chain)
-                        continue;
-                    }
-                    next = node->next.load(std::memory_order_acquire);
-                }
-            } else {
-                // Find previous node and remove from middle
-                Node* prev = head;
-                bool removed = false;
-                while (prev && !removed) {
-                    Node* next = prev->next.load(std::memory_order_acquire);
-                    if (next == node) {
-                        Node* node_next = node->next.load(std::memory_order_acquire);
-                        if (prev->next.compare_exchange_weak(
-                            next, node_next,
-                            std::memory_order_release,
-                            std::memory_order_acquire)) {
-                            removed = true;
-                        } else {
-                            // CAS failed, chain changed - restart search from beginning
-                            break;
-                        }
-                    } else if (next == nullptr) {
-                        // Reached end of chain, node not found (might have been removed)
-                        break;
-                    }
-                    prev = next;
-                }
-                
-                // If removal failed, retry from the beginning
-                if (!removed) {
-                    continue;
-                }
-            }
+        // Killing the value removes the key; whoever kills it owns the removal
+        NodeBase* node = pos.curr;
+        if (!kill_value(static_cast<Node*>(node))) {
+            return false;
+        }
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        mark_deleted(node);
 
-            // Successfully removed from chain, now safe to delete
-            size_.fetch_sub(1, std::memory_order_relaxed);
-            
-            // Delete value first
-            Value* val = node->value.exchange(nullptr, std::memory_order_acq_rel);
-            if (val) {
-                delete val;
-            }
-            
-            // Delete node (safe now as it's removed from chain and marked)
-            delete node;
-            return true;
+        // Unlink it; if the predecessor changed, a traversal finishes the job.
+        // Only the thread whose CAS unlinks the node retires it, and the
+        // node is freed once no reader can reach it.
+        NodeBase* expected = node;
+        if (pos.prev->compare_exchange_strong(expected,
+                                              unmarked(node->next.load(std::memory_order_acquire)),
+                                              std::memory_order_acq_rel,
+                                              std::memory_order_acquire)) {
+            Reclaimer::retire(node, &reclaim_node);
+        } else {
+            find(start, order, &key, guard, pos);
         }
+        return true;
     }
 
     /**
@@ -228,8 +808,23 @@ public:
      * @return true if key exists, false otherwise
      */
     bool contains(const Key& key) const {
-        const Bucket& bucket = buckets_[bucket_index(key)];
-        return find_node(bucket, key) != nullptr;
+        const size_t hash = hasher_(key);
+        NodeBase* start = sentinel_for(hash);
+        Guard guard;
+        Position pos;
+        return find(start, element_order(hash), &key, guard, pos) &&
+               is_live(static_cast<Node*>(pos.curr));
+    }
+
+    /**
+     * @brief Gets the current number of buckets
+     *
+     * Doubles whenever the load factor passes LOAD_FACTOR_THRESHOLD.
+     *
+     * @return Bucket count (a power of two)
+     */
+    size_t bucket_count() const noexcept {
+        return bucket_count_.load(std::memory_order_acquire);
     }
 
     /**
@@ -1,13 +1,33 @@
 #pragma once
 
+#include "epoch.hpp"
+#include "event_count.hpp"
+#include "striped_counter.hpp"
+#include "node_pool.hpp"
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <optional>
-#include <thread>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 namespace concurrent {
 
+/**
+ * @brief Outcome of a dequeue that distinguishes a closed queue from an empty one
+ */
+enum class DequeueStatus {
+    kOk,      // An item was dequeued
+    kEmpty,   // No item right now; more may arrive
+    kClosed,  // The queue is closed and drained; no item will ever arrive
+    kTimeout, // The deadline passed before an item arrived
+};
+
 /**
  * @brief Lock-free, wait-free concurrent queue implementation
  * 
@@ -15,57 +35,531 @@ namespace concurrent {
  * and memory ordering to achieve lock-free synchronization. It's designed
  * for high-throughput scenarios where multiple threads need to enqueue and
  * dequeue items concurrently.
+ *
+ * Producers that hold a ProducerToken enqueue into a private lane (a
+ * sub-queue with its own head and tail) instead of the shared one, so they no
+ * longer contend on a single tail. Consumers rotate across all lanes. Order
+ * is FIFO per lane: items from one producer stay in order, but there is no
+ * global order between producers using different lanes.
+ *
+ * close() ends the stream: later enqueues fail, consumers drain what is left
+ * and then get DequeueStatus::kClosed instead of waiting, and parked
+ * consumers are woken.
  * 
  * @tparam T The type of elements stored in the queue
+ * @tparam Reclaimer Memory reclamation policy for dequeued nodes
+ *         (EpochDomain or HazardPointerDomain)
+ * @tparam Allocator Allocator for nodes, rebound to the node type. Each node
+ *         keeps a copy to free itself with, since reclamation may run after
+ *         the queue is gone; empty allocators take no space.
  */
-template<typename T>
+template<typename T, typename Reclaimer = EpochDomain, typename Allocator = PoolAllocator<T>>
 class LockFreeQueue {
     static_assert(std::is_move_constructible_v<T> || std::is_copy_constructible_v<T>,
                   "T must be move or copy constructible");
 
 private:
+    // Payload lifecycle of a node: constructed before the node is linked,
+    // taken by the dequeuer that claims it. While the payload is ready,
+    // snapshot readers pin it by adding kReader; the dequeuer turns the ready
+    // bit into a pin of its own, and whoever unpins last destroys the payload.
+    enum NodeState : std::uint32_t {
+        kEmpty = 0,
+        kReady = 1,
+        kReader = 2,
+    };
+
+    struct Node;
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    // The payload lives inline, so an element costs one (pooled) allocation
     struct Node {
-        std::atomic<T*> data{nullptr};
         std::atomic<Node*> next{nullptr};
-        
-        Node() = default;
+        std::atomic<std::uint32_t> state{kEmpty};
+        [[no_unique_address]] NodeAllocator allocator; // Frees this node
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        explicit Node(const NodeAllocator& alloc) noexcept : allocator(alloc) {}
+
+        T* value() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+
+        /**
+         * @brief Hands the payload to the dequeuer that owns it, never waiting
+         *
+         * Clearing the ready bit hides the payload from new readers. With none
+         * pinning it, sink gets it as an rvalue to move from; while readers are
+         * still visiting it, sink gets a const reference to copy from and the
+         * last reader destroys it. Readers need a copyable T, so a move-only
+         * payload is always moved.
+         */
+        template<typename Sink>
+        void consume(Sink&& sink) {
+            std::uint32_t previous = state.fetch_add(kReader - kReady, std::memory_order_acq_rel);
+            try {
+                if constexpr (std::is_copy_constructible_v<T>) {
+                    if (previous != kReady) {
+                        sink(std::as_const(*value()));
+                        unpin();
+                        return;
+                    }
+                }
+                sink(std::move(*value()));
+            } catch (...) {
+                unpin();
+                throw;
+            }
+            unpin();
+        }
+
+        // Drops a pin; the last one out after the dequeuer destroys the payload
+        void unpin() noexcept {
+            if (state.fetch_sub(kReader, std::memory_order_acq_rel) == kReader) {
+                value()->~T();
+            }
+        }
+
+        // Calls fn on the payload if it is still ready; returns whether it did
+        template<typename F>
+        bool read(F& fn) {
+            std::uint32_t current = state.load(std::memory_order_acquire);
+            while (current & kReady) {
+                if (state.compare_exchange_weak(current, current + kReader,
+                                                std::memory_order_acquire,
+                                                std::memory_order_acquire)) {
+                    try {
+                        fn(std::as_const(*value()));
+                    } catch (...) {
+                        unpin();
+                        throw;
+                    }
+                    unpin();
+                    return true;
+                }
+            }
+            return false;
+        }
     };
 
-    alignas(64) std::atomic<Node*> head_;
-    alignas(64) std::atomic<Node*> tail_;
+    // A Michael-Scott sub-queue: head points at a dummy node, tail at the last one
+    struct Lane {
+        alignas(64) std::atomic<Node*> head;
+        alignas(64) std::atomic<Node*> tail;
+        std::atomic<bool> claimed{false}; // Owned by a live ProducerToken
+
+        explicit Lane(const NodeAllocator& allocator) {
+            Node* dummy = allocate_node(allocator);
+            head.store(dummy, std::memory_order_relaxed);
+            tail.store(dummy, std::memory_order_relaxed);
+        }
+
+        // Not thread-safe: destroys the elements still linked in the lane
+        ~Lane() {
+            destroy_chain(head.load(std::memory_order_relaxed));
+        }
+
+        Lane(const Lane&) = delete;
+        Lane& operator=(const Lane&) = delete;
+    };
+
+    // Token lanes beyond this limit are shared between producers
+    static constexpr std::size_t kMaxLanes = 64;
+
+    // Dequeue attempts before a blocking consumer registers as a waiter
+    static constexpr int kSpinTries = 64;
+
+    [[no_unique_address]] NodeAllocator allocator_;
+    mutable Lane main_; // Lane for enqueues without a token
+    std::atomic<Lane*> lanes_[kMaxLanes] = {};
+    std::atomic<std::size_t> lane_count_{0};
+    std::mutex lanes_mutex_; // Serializes token creation only
+    std::size_t next_shared_lane_ = 0;
+    alignas(64) EventCount not_empty_; // Parks consumers of the blocking dequeues
+    alignas(64) std::atomic<bool> closed_{false};
+    StripedCounter size_; // Accepted or in-flight elements minus dequeued ones
+
+    // Per-consumer starting point when rotating across lanes
+    inline static thread_local std::size_t t_rotation_ = 0;
+
+    // By default nodes come from a per-thread slab pool, so steady-state
+    // traffic does not touch the global allocator
+    static Node* allocate_node(const NodeAllocator& allocator) {
+        NodeAllocator alloc(allocator);
+        return new (NodeTraits::allocate(alloc, 1)) Node(allocator);
+    }
+
+    static void deallocate_node(Node* node) {
+        NodeAllocator alloc(std::move(node->allocator));
+        node->~Node();
+        NodeTraits::deallocate(alloc, node, 1);
+    }
+
+    // Deleter handed to the reclamation domain for retired dummy nodes
+    static void reclaim_node(void* node) {
+        deallocate_node(static_cast<Node*>(node));
+    }
+
+    // Not thread-safe: frees a chain of nodes and the payloads still in it
+    static void destroy_chain(Node* node) {
+        while (node) {
+            Node* next = node->next.load(std::memory_order_relaxed);
+            if (node->state.load(std::memory_order_relaxed) & kReady) {
+                node->value()->~T();
+            }
+            deallocate_node(node);
+            node = next;
+        }
+    }
+
+    // Lane 0 is the shared lane, token lanes follow
+    Lane* lane_at(std::size_t index) const noexcept {
+        return index == 0 ? &main_ : lanes_[index - 1].load(std::memory_order_acquire);
+    }
 
-    // Memory pool for nodes to reduce allocations
-    Node* allocate_node() {
-        return new Node();
+    // Builds an unlinked node holding a T constructed from args
+    template<typename... Args>
+    Node* make_node(Args&&... args) {
+        Node* node = allocate_node(allocator_);
+        try {
+            new (node->storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate_node(node);
+            throw;
+        }
+        // Published to consumers by the release store linking the node
+        node->state.store(kReady, std::memory_order_relaxed);
+        return node;
     }
 
-    void deallocate_node(Node* node) {
-        delete node;
+    // Appends the linked chain first..last holding count items to a lane, or
+    // frees it and returns false if the queue is closed
+    bool publish(Lane& lane, Node* first, Node* last, std::size_t count) {
+        // Counting the items before the closed_ check means a consumer that
+        // sees the queue closed and size_ at zero has seen every accepted item
+        size_.add(static_cast<std::int64_t>(count), std::memory_order_seq_cst);
+        if (closed_.load(std::memory_order_seq_cst)) {
+            size_.add(-static_cast<std::int64_t>(count), std::memory_order_seq_cst);
+            not_empty_.notify_all(); // Waiters may have seen the transient count
+            destroy_chain(first);
+            return false;
+        }
+
+        // seq_cst so that blocked consumers are not missed
+        Node* prev_tail = lane.tail.exchange(last, std::memory_order_seq_cst);
+        prev_tail->next.store(first, std::memory_order_release);
+        if (count == 1 && !closed_.load(std::memory_order_seq_cst)) {
+            not_empty_.notify_one();
+        } else {
+            // After close, parked consumers also wait for the drain to finish
+            not_empty_.notify_all();
+        }
+        return true;
+    }
+
+    template<typename It>
+    std::size_t enqueue_bulk_to(Lane& lane, It first, It last) {
+        Node* chain_head = nullptr;
+        Node* chain_tail = nullptr;
+        std::size_t count = 0;
+        try {
+            for (; first != last; ++first) {
+                Node* node = make_node(*first);
+                if (chain_tail) {
+                    chain_tail->next.store(node, std::memory_order_relaxed);
+                } else {
+                    chain_head = node;
+                }
+                chain_tail = node;
+                ++count;
+            }
+        } catch (...) {
+            // Nothing was published yet: tear the private chain down
+            destroy_chain(chain_head);
+            throw;
+        }
+
+        // The release store publishes every link of the chain at once
+        if (count > 0 && !publish(lane, chain_head, chain_tail, count)) {
+            return 0;
+        }
+        return count;
+    }
+
+    // Accounts for claimed items; after close, the last one wakes waiters to drain
+    void consumed(std::size_t count) noexcept {
+        size_.add(-static_cast<std::int64_t>(count), std::memory_order_seq_cst);
+        if (closed_.load(std::memory_order_seq_cst)) {
+            not_empty_.notify_all();
+        }
+    }
+
+    std::optional<T> dequeue_from(Lane& lane, typename Reclaimer::Guard& guard) {
+        while (true) {
+            Node* head = guard.protect(0, lane.head);
+            Node* next = guard.protect(1, head->next);
+
+            // next is only guaranteed to be alive while head is still the dummy
+            if (lane.head.load(std::memory_order_acquire) != head) {
+                continue;
+            }
+
+            if (next == nullptr) {
+                return std::nullopt; // Lane is empty
+            }
+
+            // Try to atomically update head - only one thread succeeds
+            if (lane.head.compare_exchange_weak(head, next, std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+                // This thread owns next's payload; next becomes the new dummy
+                consumed(1);
+                std::optional<T> result;
+                next->consume([&result](auto&& value) {
+                    result.emplace(std::forward<decltype(value)>(value));
+                });
+
+                // The old dummy is unreachable from head, but concurrent
+                // dequeuers may still be reading it. Enqueuers are done with it:
+                // its next pointer was the last thing they wrote. Hand it to
+                // the reclamation domain, which frees it once no thread can
+                // still be reading it.
+                Reclaimer::retire(head, &reclaim_node);
+
+                return result;
+            }
+            // CAS failed, another thread updated head first - retry
+        }
+    }
+
+    // Claims up to max nodes of one lane with a single head CAS
+    template<typename OutIt>
+    std::size_t dequeue_bulk_from(Lane& lane, OutIt& out, std::size_t max,
+                                  typename Reclaimer::Guard& guard) {
+        Node* head;
+        Node* last;
+        std::size_t claimed;
+        while (true) {
+            head = guard.protect(0, lane.head);
+            last = head;
+            claimed = 0;
+            std::size_t slot = 1;
+            bool stale = false;
+            while (claimed < max) {
+                // Nodes past head stay alive while head is still the dummy
+                Node* next = last->next.load(std::memory_order_acquire);
+                guard.announce(slot, next);
+                if (lane.head.load(std::memory_order_acquire) != head) {
+                    stale = true;
+                    break;
+                }
+                if (next == nullptr) {
+                    break;
+                }
+                last = next;
+                ++claimed;
+                slot = 3 - slot;
+            }
+
+            if (stale) {
+                continue;
+            }
+            if (claimed == 0) {
+                return 0; // Lane is empty
+            }
+            if (lane.head.compare_exchange_weak(head, last, std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+                break;
+            }
+        }
+
+        // This thread now owns every node between head and last: their links
+        // are final and no other dequeuer can reach them
+        consumed(claimed);
+        std::size_t written = 0;
+        std::exception_ptr error;
+        Node* node = head;
+        while (node != last) {
+            Node* next = node->next.load(std::memory_order_acquire);
+            Reclaimer::retire(node, &reclaim_node);
+            if (!error) {
+                try {
+                    next->consume([&out](auto&& value) {
+                        *out = std::forward<decltype(value)>(value);
+                    });
+                    ++out;
+                    ++written;
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            } else {
+                next->consume([](auto&&) {}); // Just destroys it
+            }
+            node = next;
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return written;
+    }
+
+    // Visits up to max ready elements of one lane, front to back
+    template<typename F>
+    std::size_t snapshot_lane(Lane& lane, std::size_t max, F& fn,
+                              typename Reclaimer::Guard& guard) const {
+        Node* head = guard.protect(0, lane.head);
+        Node* current = head;
+        std::size_t visited = 0;
+        std::size_t slot = 1;
+        while (visited < max) {
+            Node* next = current->next.load(std::memory_order_acquire);
+            guard.announce(slot, next);
+            if constexpr (!Reclaimer::kGuardProtectsAll) {
+                // Nodes past head are only known to be alive while head is
+                // still the dummy; stop once consumers overtake the walk
+                if (lane.head.load(std::memory_order_acquire) != head) {
+                    break;
+                }
+            }
+            if (next == nullptr) {
+                break;
+            }
+            if (next->read(fn)) {
+                ++visited;
+            }
+            current = next;
+            slot = 3 - slot;
+        }
+        return visited;
+    }
+
+    // Emptiness check for a registered waiter. The seq_cst loads pair with
+    // the seq_cst tail exchange of publish(): either they observe the new
+    // tail, or the producer observes the waiter and notifies it. A node that
+    // is swapped in but not linked yet counts as non-empty. Lanes registered
+    // before a producer's exchange are covered by the same argument.
+    bool empty_for_waiter() const noexcept {
+        typename Reclaimer::Guard guard;
+        std::size_t count = lane_count_.load(std::memory_order_seq_cst);
+        for (std::size_t i = 0; i <= count; ++i) {
+            Lane* lane = lane_at(i);
+            Node* head = guard.protect(0, lane->head);
+            if (lane->tail.load(std::memory_order_seq_cst) != head) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Shared body of the blocking dequeues; no deadline means wait forever
+    // True once no item can ever be dequeued again: after close, size_ only
+    // counts items that are linked or about to be
+    bool drained() const noexcept {
+        return closed_.load(std::memory_order_seq_cst) &&
+               size_.sum(std::memory_order_seq_cst) <= 0;
+    }
+
+    // Empty result with status kClosed, or kTimeout once the deadline passes
+    std::optional<T> dequeue_blocking(const std::chrono::steady_clock::time_point* deadline,
+                                      DequeueStatus& status) {
+        status = DequeueStatus::kOk;
+        while (true) {
+            for (int i = 0; i < kSpinTries; ++i) {
+                if (auto item = dequeue()) {
+                    return item;
+                }
+            }
+
+            EventCount::Key key = not_empty_.prepare_wait();
+            if (!empty_for_waiter()) {
+                not_empty_.cancel_wait();
+                continue;
+            }
+            if (drained()) {
+                not_empty_.cancel_wait();
+                status = DequeueStatus::kClosed;
+                return std::nullopt;
+            }
+            if (!deadline) {
+                not_empty_.wait(key);
+            } else if (!not_empty_.wait_until(key, *deadline)) {
+                // Timed out: one last look
+                if (auto item = dequeue()) {
+                    return item;
+                }
+                status = drained() ? DequeueStatus::kClosed : DequeueStatus::kTimeout;
+                return std::nullopt;
+            }
+        }
     }
 
 public:
+    /**
+     * @brief Handle that routes a producer's enqueues to its own lane
+     *
+     * Obtained from make_producer_token() and used by a single producer
+     * thread at a time. Destroying the token frees the lane for a later token;
+     * items still in it stay visible to consumers. A token must not outlive
+     * its queue.
+     */
+    class ProducerToken {
+    public:
+        ProducerToken(ProducerToken&& other) noexcept
+            : lane_(std::exchange(other.lane_, nullptr)), owner_(other.owner_) {}
+
+        ProducerToken& operator=(ProducerToken&& other) noexcept {
+            if (this != &other) {
+                release();
+                lane_ = std::exchange(other.lane_, nullptr);
+                owner_ = other.owner_;
+            }
+            return *this;
+        }
+
+        ~ProducerToken() {
+            release();
+        }
+
+        ProducerToken(const ProducerToken&) = delete;
+        ProducerToken& operator=(const ProducerToken&) = delete;
+
+    private:
+        friend class LockFreeQueue;
+
+        ProducerToken(Lane* lane, bool owner) noexcept : lane_(lane), owner_(owner) {}
+
+        void release() noexcept {
+            if (lane_ && owner_) {
+                lane_->claimed.store(false, std::memory_order_release);
+            }
+            lane_ = nullptr;
+        }
+
+        Lane* lane_;
+        bool owner_;
+    };
+
     /**
      * @brief Constructs an empty lock-free queue
      */
-    LockFreeQueue() {
-        Node* dummy = allocate_node();
-        head_.store(dummy, std::memory_order_relaxed);
-        tail_.store(dummy, std::memory_order_relaxed);
-    }
+    LockFreeQueue() : LockFreeQueue(Allocator()) {}
 
     /**
-     * @brief Destructor - not thread-safe, queue must be empty
+     * @brief Constructs an empty lock-free queue whose nodes come from an allocator
+     *
+     * @param allocator Allocator to rebind for nodes, e.g. a NUMA-local arena
+     */
+    explicit LockFreeQueue(const Allocator& allocator)
+        : allocator_(allocator), main_(allocator_) {}
+
+    /**
+     * @brief Destructor - not thread-safe, destroys remaining elements
      */
     ~LockFreeQueue() {
-        Node* current = head_.load(std::memory_order_relaxed);
-        while (current) {
-            Node* next = current->next.load(std::memory_order_relaxed);
-            T* data = current->data.load(std::memory_order_relaxed);
-            if (data) {
-                delete data;
-            }
-            deallocate_node(current);
-            current = next;
+        std::size_t count = lane_count_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < count; ++i) {
+            delete lanes_[i].load(std::memory_order_relaxed);
         }
     }
 
@@ -75,25 +569,136 @@ public:
     LockFreeQueue(LockFreeQueue&&) = delete;
     LockFreeQueue& operator=(LockFreeQueue&&) = delete;
 
+    /**
+     * @brief Enqueues a copy of an item into the queue
+     *
+     * @param item The item to enqueue
+     * @return true if successful, false if the queue is closed
+     */
+    bool enqueue(const T& item) {
+        return emplace(item);
+    }
+
     /**
      * @brief Enqueues an item into the queue
-     * 
-     * @param item The item to enqueue (will be moved if possible)
-     * @return true if successful, false otherwise
-     */
-    bool enqueue(T item) {
-        Node* new_node = allocate_node();
-        T* data = new T(std::move(item));
-        
-        // Set data with release semantics
-        new_node->data.store(data, std::memory_order_release);
-        new_node->next.store(nullptr, std::memory_order_relaxed);
-
-        // Lock-free enqueue using compare-and-swap
-        Node* prev_tail = tail_.exchange(new_node, std::memory_order_acq_rel);
-        prev_tail->next.store(new_node, std::memory_order_release);
-        
-        return true;
+     *
+     * @param item The item to enqueue (will be moved)
+     * @return true if successful, false if the queue is closed
+     */
+    bool enqueue(T&& item) {
+        return emplace(std::move(item));
+    }
+
+    /**
+     * @brief Constructs an item in place at the back of the queue
+     *
+     * The item is built directly in its node, with no temporary to move from.
+     * If the queue is closed the item is constructed and then destroyed.
+     *
+     * @param args Arguments forwarded to T's constructor
+     * @return true if successful, false if the queue is closed
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        Node* node = make_node(std::forward<Args>(args)...);
+        return publish(main_, node, node, 1);
+    }
+
+    /**
+     * @brief Creates a token giving the calling producer its own lane
+     *
+     * Lanes released by destroyed tokens are reused. Once kMaxLanes lanes are
+     * owned, further tokens share existing lanes, which remain correct but
+     * contend again.
+     *
+     * @return Token to pass to enqueue(ProducerToken&, T)
+     */
+    ProducerToken make_producer_token() {
+        std::lock_guard<std::mutex> lock(lanes_mutex_);
+        std::size_t count = lane_count_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < count; ++i) {
+            Lane* lane = lanes_[i].load(std::memory_order_relaxed);
+            if (!lane->claimed.load(std::memory_order_acquire)) {
+                lane->claimed.store(true, std::memory_order_relaxed);
+                return ProducerToken(lane, true);
+            }
+        }
+
+        if (count < kMaxLanes) {
+            Lane* lane = new Lane(allocator_);
+            lane->claimed.store(true, std::memory_order_relaxed);
+            lanes_[count].store(lane, std::memory_order_release);
+            lane_count_.store(count + 1, std::memory_order_seq_cst);
+            return ProducerToken(lane, true);
+        }
+
+        // Lanes are multi-producer safe, so sharing only costs contention
+        Lane* shared = lanes_[next_shared_lane_++ % kMaxLanes].load(std::memory_order_relaxed);
+        return ProducerToken(shared, false);
+    }
+
+    /**
+     * @brief Enqueues a copy of an item into the token's lane
+     *
+     * @param token Token obtained from this queue's make_producer_token()
+     * @param item The item to enqueue
+     * @return true if successful, false if the queue is closed
+     */
+    bool enqueue(ProducerToken& token, const T& item) {
+        return emplace(token, item);
+    }
+
+    /**
+     * @brief Enqueues an item into the token's lane
+     *
+     * @param token Token obtained from this queue's make_producer_token()
+     * @param item The item to enqueue (will be moved)
+     * @return true if successful, false if the queue is closed
+     */
+    bool enqueue(ProducerToken& token, T&& item) {
+        return emplace(token, std::move(item));
+    }
+
+    /**
+     * @brief Constructs an item in place at the back of the token's lane
+     *
+     * @param token Token obtained from this queue's make_producer_token()
+     * @param args Arguments forwarded to T's constructor
+     * @return true if successful, false if the queue is closed
+     */
+    template<typename... Args>
+    bool emplace(ProducerToken& token, Args&&... args) {
+        Node* node = make_node(std::forward<Args>(args)...);
+        return publish(*token.lane_, node, node, 1);
+    }
+
+    /**
+     * @brief Enqueues a range of items with a single tail exchange
+     *
+     * The items are linked into a private chain first and then published
+     * together, so they are consumed in order and without interleaving with
+     * other producers.
+     *
+     * @param first Iterator to the first item (use std::make_move_iterator to move)
+     * @param last Iterator past the last item
+     * @return Number of items enqueued; 0 if the queue is closed
+     */
+    template<typename It>
+    std::size_t enqueue_bulk(It first, It last) {
+        return enqueue_bulk_to(main_, first, last);
+    }
+
+    /**
+     * @brief Enqueues a range of items into the token's lane
+     *
+     * @param token Token obtained from this queue's make_producer_token()
+     * @param first Iterator to the first item (use std::make_move_iterator to move)
+     * @param last Iterator past the last item
+     * @return Number of items enqueued; 0 if the queue is closed
+     */
+    template<typename It>
+    std::size_t enqueue_bulk(ProducerToken& token, It first, It last) {
+        return enqueue_bulk_to(*token.lane_, first, last);
     }
 
     /**
@@ -102,49 +707,211 @@ public:
      * @return std::optional<T> containing the item if available, empty otherwise
      */
     std::optional<T> dequeue() {
-        while (true) {
-            Node* head = head_.load(std::memory_order_acquire);
-            Node* next = head->next.load(std::memory_order_acquire);
+        typename Reclaimer::Guard guard;
+        std::size_t count = lane_count_.load(std::memory_order_acquire);
+        if (count == 0) {
+            return dequeue_from(main_, guard);
+        }
 
-            if (next == nullptr) {
-                return std::nullopt; // Queue is empty
+        // Start at a different lane each time so no lane is starved
+        std::size_t start = t_rotation_++;
+        for (std::size_t i = 0; i <= count; ++i) {
+            if (auto item = dequeue_from(*lane_at((start + i) % (count + 1)), guard)) {
+                return item;
             }
+        }
+        return std::nullopt;
+    }
 
-            T* data = next->data.load(std::memory_order_acquire);
-            if (data == nullptr) {
-                return std::nullopt;
-            }
+    /**
+     * @brief Attempts to dequeue an item, telling a closed queue from an empty one
+     *
+     * @param out Receives the item by move assignment on success
+     * @return kOk, kEmpty, or kClosed once the queue is closed and drained
+     */
+    DequeueStatus try_dequeue(T& out) {
+        if (auto item = dequeue()) {
+            out = std::move(*item);
+            return DequeueStatus::kOk;
+        }
+        return drained() ? DequeueStatus::kClosed : DequeueStatus::kEmpty;
+    }
 
-            // Try to atomically update head - only one thread succeeds
-            if (head_.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire)) {
-                // This thread successfully updated head
-                // Now we can safely move the data out and clean up
-                T result = std::move(*data);
-                delete data;
-                // Clear the data pointer to avoid issues in destructor
-                next->data.store(nullptr, std::memory_order_release);
-                
-                // Memory reclamation: In a lock-free queue without proper memory
-                // reclamation (hazard pointers or epoch-based reclamation), safely
-                // deleting nodes during concurrent operations is extremely difficult.
-                // The old_head might still be referenced by tail_ in concurrent
-                // enqueue operations, leading to use-after-free.
-                //
-                // For safety, we defer all node deletion to the destructor.
-                // This guarantees thread safety at the cost of increased memory usage
-                // during the queue's lifetime. The destructor will clean up all nodes
-                // when the queue is destroyed (and presumably empty or no longer in use).
-                //
-                // Note: For production use with long-lived queues, consider implementing
-                // hazard pointers or epoch-based reclamation for proper memory management.
-                
-                // Skip node deletion - will be handled by destructor
-                // This is the safest approach without proper memory reclamation
-                
-                return result;
-            }
-            // CAS failed, another thread updated head first - retry
+    /**
+     * @brief Dequeues an item, blocking until one is available
+     *
+     * Spins briefly, then parks the thread until a producer enqueues.
+     * Producers only pay for a wakeup when a consumer is parked.
+     *
+     * @return The dequeued item
+     * @throws std::runtime_error if the queue is closed and drained; use
+     *         dequeue_wait(T&) when the queue may be closed
+     */
+    T dequeue_wait() {
+        DequeueStatus status;
+        auto item = dequeue_blocking(nullptr, status);
+        if (!item) {
+            throw std::runtime_error("LockFreeQueue is closed and drained");
+        }
+        return std::move(*item);
+    }
+
+    /**
+     * @brief Dequeues an item, blocking until one is available or the queue is drained
+     *
+     * @param out Receives the item by move assignment on success
+     * @return kOk, or kClosed once the queue is closed and drained
+     */
+    DequeueStatus dequeue_wait(T& out) {
+        DequeueStatus status;
+        if (auto item = dequeue_blocking(nullptr, status)) {
+            out = std::move(*item);
         }
+        return status;
+    }
+
+    /**
+     * @brief Dequeues an item, blocking for at most @p timeout
+     *
+     * Returns early, without an item, once the queue is closed and drained.
+     *
+     * @param timeout Maximum time to wait
+     * @return std::optional<T> containing the item, empty on timeout or close
+     */
+    template<typename Rep, typename Period>
+    std::optional<T> dequeue_for(const std::chrono::duration<Rep, Period>& timeout) {
+        DequeueStatus status;
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::ceil<std::chrono::steady_clock::duration>(timeout);
+        return dequeue_blocking(&deadline, status);
+    }
+
+    /**
+     * @brief Dequeues an item, blocking for at most @p timeout
+     *
+     * @param out Receives the item by move assignment on success
+     * @param timeout Maximum time to wait
+     * @return kOk, kTimeout, or kClosed once the queue is closed and drained
+     */
+    template<typename Rep, typename Period>
+    DequeueStatus dequeue_for(T& out, const std::chrono::duration<Rep, Period>& timeout) {
+        DequeueStatus status;
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::ceil<std::chrono::steady_clock::duration>(timeout);
+        if (auto item = dequeue_blocking(&deadline, status)) {
+            out = std::move(*item);
+        }
+        return status;
+    }
+
+    /**
+     * @brief Dequeues an item, blocking until @p deadline at the latest
+     *
+     * @param deadline Absolute timeout on any clock
+     * @return std::optional<T> containing the item, empty on timeout or close
+     */
+    template<typename Clock, typename Duration>
+    std::optional<T> dequeue_until(const std::chrono::time_point<Clock, Duration>& deadline) {
+        return dequeue_for(deadline - Clock::now());
+    }
+
+    /**
+     * @brief Dequeues an item, blocking until @p deadline at the latest
+     *
+     * @param out Receives the item by move assignment on success
+     * @param deadline Absolute timeout on any clock
+     * @return kOk, kTimeout, or kClosed once the queue is closed and drained
+     */
+    template<typename Clock, typename Duration>
+    DequeueStatus dequeue_until(T& out, const std::chrono::time_point<Clock, Duration>& deadline) {
+        return dequeue_for(out, deadline - Clock::now());
+    }
+
+    /**
+     * @brief Dequeues up to @p max items with one head CAS per lane
+     *
+     * Within a lane the consumer walks up to @p max linked nodes past the
+     * dummy, then claims them all by swinging the lane's head to the last one.
+     *
+     * @param out Output iterator receiving the items by move
+     * @param max Maximum number of items to dequeue
+     * @return Number of items written to @p out
+     * @throws Rethrows the first exception thrown while writing to @p out;
+     *         the remaining claimed items are destroyed
+     */
+    template<typename OutIt>
+    std::size_t try_dequeue_bulk(OutIt out, std::size_t max) {
+        typename Reclaimer::Guard guard;
+        std::size_t count = lane_count_.load(std::memory_order_acquire);
+        std::size_t start = count == 0 ? 0 : t_rotation_++;
+        std::size_t taken = 0;
+        for (std::size_t i = 0; i <= count && taken < max; ++i) {
+            Lane& lane = *lane_at((start + i) % (count + 1));
+            taken += dequeue_bulk_from(lane, out, max - taken, guard);
+        }
+        return taken;
+    }
+
+    /**
+     * @brief Visits up to @p max elements without removing them
+     *
+     * Walks each lane from the front under a reclamation guard, so no node can
+     * be freed underneath the walk, and calls @p fn with a const reference to
+     * every element that has not been dequeued yet. The view is weakly
+     * consistent: elements enqueued or dequeued during the walk may or may not
+     * be seen. Consumers never wait for the walk: one that dequeues an element
+     * @p fn is visiting takes a copy of it, and the element is destroyed when
+     * @p fn returns. @p fn may itself dequeue. Requires a copyable T.
+     *
+     * @param max Maximum number of elements to visit
+     * @param fn Callable invoked as fn(const T&)
+     * @return Number of elements visited
+     */
+    template<typename F>
+    std::size_t for_each_snapshot(std::size_t max, F&& fn) const {
+        static_assert(std::is_copy_constructible_v<T>,
+                      "a consumer copies an element that a snapshot is visiting");
+        typename Reclaimer::Guard guard;
+        std::size_t count = lane_count_.load(std::memory_order_acquire);
+        std::size_t visited = 0;
+        for (std::size_t i = 0; i <= count && visited < max; ++i) {
+            visited += snapshot_lane(*lane_at(i), max - visited, fn, guard);
+        }
+        return visited;
+    }
+
+    /**
+     * @brief Copies the front element without removing it
+     *
+     * With producer tokens, this is the front of the first non-empty lane.
+     *
+     * @return std::optional<T> containing a copy, empty if the queue is empty
+     */
+    std::optional<T> peek() const {
+        std::optional<T> front;
+        for_each_snapshot(1, [&front](const T& value) { front.emplace(value); });
+        return front;
+    }
+
+    /**
+     * @brief Closes the queue for producers
+     *
+     * Enqueues that start afterwards fail. Items already accepted stay
+     * dequeueable; once they are gone, consumers get DequeueStatus::kClosed
+     * and every parked consumer is woken. Closing is permanent and idempotent.
+     */
+    void close() noexcept {
+        closed_.store(true, std::memory_order_seq_cst);
+        not_empty_.notify_all();
+    }
+
+    /**
+     * @brief Checks if close() has been called
+     *
+     * @return true if the queue is closed (it may still hold items)
+     */
+    bool is_closed() const noexcept {
+        return closed_.load(std::memory_order_acquire);
     }
 
     /**
@@ -154,28 +921,28 @@ public:
      * @return true if queue appears empty, false otherwise
      */
     bool empty() const noexcept {
-        Node* head = head_.load(std::memory_order_acquire);
-        Node* next = head->next.load(std::memory_order_acquire);
-        return next == nullptr;
+        typename Reclaimer::Guard guard;
+        std::size_t count = lane_count_.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i <= count; ++i) {
+            Node* head = guard.protect(0, lane_at(i)->head);
+            if (head->next.load(std::memory_order_acquire) != nullptr) {
+                return false;
+            }
+        }
+        return true;
     }
 
     /**
      * @brief Gets the approximate size of the queue
-     * 
-     * @warning This is expensive and only approximate
+     *
+     * Sums striped enqueue/dequeue counters: O(1) in the queue length and
+     * never touches nodes. Exact when no operation is in flight.
+     *
      * @return Approximate number of elements
      */
-    size_t approximate_size() const {
-        size_t count = 0;
-        Node* current = head_.load(std::memory_order_acquire);
-        while (current) {
-            Node* next = current->next.load(std::memory_order_acquire);
-            if (next && next->data.load(std::memory_order_acquire)) {
-                ++count;
-            }
-            current = next;
-        }
-        return count;
+    size_t approximate_size() const noexcept {
+        std::int64_t size = size_.sum();
+        return size > 0 ? static_cast<size_t>(size) : 0;
     }
 };
 
@@ -0,0 +1,265 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace concurrent {
+
+/**
+ * @brief Fixed-size block pool with per-thread caches and a lock-free depot
+ *
+ * Blocks are carved out of large slabs. Each thread allocates from and frees
+ * to its own cache without any atomic operation. When a cache runs dry it
+ * takes a whole batch of blocks from the global depot (or carves from a new
+ * slab); when it grows past two batches it hands one back. This lets blocks freed by
+ * consumer threads flow back to producer threads, so a producer/consumer
+ * pipeline is allocation-free once warmed up.
+ *
+ * The depot is an array of batch slots rather than a linked stack: a batch is
+ * taken with a single exchange, so there is no ABA problem to solve. Slabs are
+ * never returned to the system; the pool is sized by its peak usage.
+ *
+ * All node types of the same size and alignment share one pool.
+ *
+ * @tparam Size Block size in bytes
+ * @tparam Align Block alignment
+ */
+template<std::size_t Size, std::size_t Align = alignof(std::max_align_t)>
+class SlabPool {
+private:
+    // Overlay of a free block; the first block of a batch records its length
+    struct FreeBlock {
+        FreeBlock* next;
+        std::size_t batch_count;
+    };
+
+    struct SlabHeader {
+        SlabHeader* next;
+    };
+
+    static constexpr std::size_t kAlign =
+        std::max({Align, alignof(FreeBlock), alignof(SlabHeader)});
+    static constexpr std::size_t kBlockSize =
+        (std::max(Size, sizeof(FreeBlock)) + kAlign - 1) / kAlign * kAlign;
+    static constexpr std::size_t kBatchSize = 64;
+    static constexpr std::size_t kSlabBytes = 64 * 1024;
+    static constexpr std::size_t kBlocksPerSlab =
+        std::max(kBatchSize + 1, kSlabBytes / kBlockSize);
+    static constexpr std::size_t kDepotSlots = 64;
+
+    struct Cache {
+        FreeBlock* head = nullptr;
+        std::size_t count = 0;
+        std::size_t limit = 2 * kBatchSize;
+        unsigned char* bump = nullptr; // Uncarved remainder of the current slab
+        unsigned char* bump_end = nullptr;
+
+        ~Cache() {
+            // Return everything so other threads can reuse it
+            while (count > 0) {
+                release_batch(detach(std::min(count, kBatchSize)));
+            }
+            t_cache_destroyed = true;
+        }
+
+        FreeBlock* detach(std::size_t n) {
+            FreeBlock* first = head;
+            FreeBlock* last = head;
+            for (std::size_t i = 1; i < n; ++i) {
+                last = last->next;
+            }
+            head = last->next;
+            count -= n;
+            last->next = nullptr;
+            first->batch_count = n;
+            return first;
+        }
+
+        void attach(FreeBlock* batch) {
+            FreeBlock* last = batch;
+            while (last->next) {
+                last = last->next;
+            }
+            last->next = head;
+            head = batch;
+            count += batch->batch_count;
+        }
+    };
+
+    inline static std::atomic<FreeBlock*> depot_[kDepotSlots] = {};
+    inline static std::atomic<std::size_t> depot_hint_{0};
+    inline static std::atomic<SlabHeader*> slabs_{nullptr}; // Keeps slabs reachable
+    inline static thread_local Cache t_cache;
+    inline static thread_local bool t_cache_destroyed = false;
+
+    static FreeBlock* acquire_batch() noexcept {
+        std::size_t start = depot_hint_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < kDepotSlots; ++i) {
+            std::atomic<FreeBlock*>& slot = depot_[(start + i) % kDepotSlots];
+            if (slot.load(std::memory_order_relaxed) == nullptr) {
+                continue;
+            }
+            if (FreeBlock* batch = slot.exchange(nullptr, std::memory_order_acquire)) {
+                depot_hint_.store((start + i) % kDepotSlots, std::memory_order_relaxed);
+                return batch;
+            }
+        }
+        return nullptr;
+    }
+
+    // Returns false if the depot is full and the caller must keep the batch
+    static bool try_release_batch(FreeBlock* batch) noexcept {
+        std::size_t start = depot_hint_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < kDepotSlots; ++i) {
+            std::atomic<FreeBlock*>& slot = depot_[(start + i) % kDepotSlots];
+            FreeBlock* expected = nullptr;
+            if (slot.load(std::memory_order_relaxed) == nullptr &&
+                slot.compare_exchange_strong(expected, batch, std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+                depot_hint_.store((start + i) % kDepotSlots, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Used when a thread is going away and cannot keep its blocks
+    static void release_batch(FreeBlock* batch) noexcept {
+        while (!try_release_batch(batch)) {
+            // Depot full: absorb one of its batches so both fit in one slot
+            if (FreeBlock* other = acquire_batch()) {
+                FreeBlock* tail = batch;
+                while (tail->next) {
+                    tail = tail->next;
+                }
+                tail->next = other;
+                batch->batch_count += other->batch_count;
+            }
+        }
+    }
+
+    static void new_slab(Cache& cache) {
+        auto* bytes = static_cast<unsigned char*>(
+            ::operator new(kBlocksPerSlab * kBlockSize, std::align_val_t{kAlign}));
+
+        // The first block links the slab into the registry
+        auto* header = reinterpret_cast<SlabHeader*>(bytes);
+        header->next = slabs_.load(std::memory_order_relaxed);
+        while (!slabs_.compare_exchange_weak(header->next, header, std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+        }
+
+        cache.bump = bytes + kBlockSize;
+        cache.bump_end = bytes + kBlocksPerSlab * kBlockSize;
+    }
+
+public:
+    SlabPool() = delete;
+
+    /**
+     * @brief Allocates one block of Size bytes aligned to Align
+     *
+     * @return Uninitialized block
+     */
+    static void* allocate() {
+        Cache& cache = t_cache;
+        if (FreeBlock* block = cache.head) {
+            cache.head = block->next;
+            --cache.count;
+            return block;
+        }
+        if (cache.bump == cache.bump_end) {
+            if (FreeBlock* batch = acquire_batch()) {
+                cache.attach(batch);
+                return allocate();
+            }
+            new_slab(cache);
+        }
+        void* block = cache.bump;
+        cache.bump += kBlockSize;
+        return block;
+    }
+
+    /**
+     * @brief Returns a block to the calling thread's cache
+     *
+     * Blocks may be freed by a different thread than the one that allocated them.
+     *
+     * @param ptr Block obtained from allocate()
+     */
+    static void deallocate(void* ptr) noexcept {
+        auto* block = static_cast<FreeBlock*>(ptr);
+        if (t_cache_destroyed) {
+            // Called during thread teardown after the cache flushed itself
+            block->next = nullptr;
+            block->batch_count = 1;
+            release_batch(block);
+            return;
+        }
+
+        Cache& cache = t_cache;
+        block->next = cache.head;
+        cache.head = block;
+        if (++cache.count >= cache.limit) {
+            FreeBlock* batch = cache.detach(kBatchSize);
+            if (try_release_batch(batch)) {
+                cache.limit = std::max(2 * kBatchSize, cache.limit - kBatchSize);
+            } else {
+                // Depot full: keep the blocks and back off before trying again
+                cache.attach(batch);
+                cache.limit += kBatchSize;
+            }
+        }
+    }
+};
+
+/**
+ * @brief Pool sized for objects of type T
+ */
+template<typename T>
+using NodePool = SlabPool<sizeof(T), alignof(T)>;
+
+/**
+ * @brief Standard allocator that serves single objects from NodePool
+ *
+ * Lets containers that take an Allocator keep the pooled node allocation by
+ * default. Arrays (n != 1) go to the global allocator. Stateless: all
+ * instances are interchangeable.
+ *
+ * @tparam T Value type
+ */
+template<typename T>
+struct PoolAllocator {
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    PoolAllocator() noexcept = default;
+
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        if (n == 1) {
+            return static_cast<T*>(NodePool<T>::allocate());
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept {
+        if (n == 1) {
+            NodePool<T>::deallocate(ptr);
+        } else {
+            ::operator delete(ptr, std::align_val_t{alignof(T)});
+        }
+    }
+
+    template<typename U>
+    bool operator==(const PoolAllocator<U>&) const noexcept {
+        return true;
+    }
+};
+
+} // namespace concurrent
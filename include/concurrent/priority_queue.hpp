@@ -0,0 +1,371 @@
+#pragma once
+
+#include "epoch.hpp"
+#include "node_pool.hpp"
+#include "striped_counter.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace concurrent {
+
+/**
+ * @brief Lock-free concurrent priority queue built on a skip list
+ *
+ * Elements live in a lock-free skip list ordered by key, with ties broken by
+ * node address. A node is unlinked by setting the mark bit of its next
+ * pointers, and every traversal snips the marked nodes it passes, so
+ * inserts only contend with neighbours of the new key.
+ *
+ * try_pop() walks the bottom level from the front, claims the first
+ * unclaimed node with one exchange and then unlinks it. The result is the
+ * minimum at some point during the call (quiescent consistency): a smaller
+ * key inserted behind the walk is left for the next pop.
+ *
+ * With many consumers every exact pop fights over the first few nodes.
+ * try_pop_relaxed() first takes a SprayList-style random walk: it starts a
+ * few levels up and takes a random number of steps on each level on the
+ * way down, landing on one of roughly the first p·log p elements for p
+ * consumer threads. Consumers then claim different nodes, at the cost of
+ * popping near-minimal rather than minimal keys.
+ *
+ * Nodes are reclaimed through EpochDomain. Hazard pointers cannot cover
+ * traversals that step through already unlinked nodes.
+ *
+ * @tparam K Priority key; the smallest key under Compare pops first
+ * @tparam V Value type
+ * @tparam Compare Strict weak ordering on keys
+ */
+template<typename K, typename V, typename Compare = std::less<K>>
+class ConcurrentPriorityQueue {
+    static_assert(std::is_copy_constructible_v<K>, "K must be copy constructible");
+    static_assert(std::is_move_constructible_v<V>, "V must be move constructible");
+
+private:
+    // With a 1/4 chance of growing a level, 12 levels cover 4^12 elements
+    static constexpr int kMaxHeight = 12;
+
+    using Link = std::atomic<std::uintptr_t>; // Successor pointer, bit 0 = owner unlinked
+
+    struct Node {
+        Link next[kMaxHeight];
+        int height;
+        std::atomic<bool> linked{false};  // Every level is linked; claimable from now on
+        std::atomic<bool> claimed{false}; // Taken by a pop
+        K key;                            // Read by concurrent traversals until reclaimed
+        V value;
+
+        Node(int h, K&& k, V&& v) : height(h), key(std::move(k)), value(std::move(v)) {
+            for (Link& link : next) {
+                link.store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    Link head_[kMaxHeight] = {};
+    Compare compare_;
+    int spray_height_; // Level the relaxed pop starts its walk on
+    int spray_jump_;   // Maximum steps per level of that walk
+    StripedCounter size_;
+
+    inline static thread_local std::uint64_t t_random_ = 0;
+
+    static Node* pointer(std::uintptr_t word) noexcept {
+        return reinterpret_cast<Node*>(word & ~std::uintptr_t{1});
+    }
+
+    static bool marked(std::uintptr_t word) noexcept {
+        return (word & 1) != 0;
+    }
+
+    static std::uintptr_t word(Node* node) noexcept {
+        return reinterpret_cast<std::uintptr_t>(node);
+    }
+
+    static void deallocate_node(Node* node) {
+        node->~Node();
+        NodePool<Node>::deallocate(node);
+    }
+
+    // Deleter handed to the reclamation domain for popped nodes
+    static void reclaim_node(void* node) {
+        deallocate_node(static_cast<Node*>(node));
+    }
+
+    // xorshift64, seeded per thread on first use
+    static std::uint64_t next_random() noexcept {
+        if (t_random_ == 0) {
+            t_random_ = std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1;
+        }
+        t_random_ ^= t_random_ << 13;
+        t_random_ ^= t_random_ >> 7;
+        t_random_ ^= t_random_ << 17;
+        return t_random_;
+    }
+
+    static int random_height() noexcept {
+        std::uint64_t bits = next_random();
+        int height = 1;
+        while (height < kMaxHeight && (bits & 3) == 0) {
+            ++height;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    // Total order on nodes: by key, then by address among equal keys
+    bool before(const Node* a, const Node* b) const {
+        if (compare_(a->key, b->key)) {
+            return true;
+        }
+        return !compare_(b->key, a->key) && std::less<const Node*>{}(a, b);
+    }
+
+    // One pass of find(); false if a snip failed and the search must restart
+    bool try_find(const Node* target, Link** preds, Node** succs) {
+        Link* pred = head_;
+        for (int level = kMaxHeight - 1; level >= 0; --level) {
+            std::uintptr_t curr_word = pred[level].load(std::memory_order_acquire);
+            if (marked(curr_word)) {
+                return false; // pred itself is being unlinked
+            }
+            Node* curr = pointer(curr_word);
+            while (curr) {
+                std::uintptr_t succ_word = curr->next[level].load(std::memory_order_acquire);
+                if (marked(succ_word)) {
+                    // curr is being unlinked: help by snipping it at this level
+                    std::uintptr_t expected = word(curr);
+                    if (!pred[level].compare_exchange_strong(expected, succ_word & ~std::uintptr_t{1},
+                                                             std::memory_order_acq_rel,
+                                                             std::memory_order_acquire)) {
+                        return false;
+                    }
+                    curr = pointer(succ_word);
+                    continue;
+                }
+                if (!before(curr, target)) {
+                    break;
+                }
+                pred = curr->next;
+                curr = pointer(succ_word);
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+        return true;
+    }
+
+    // Locates target's position on every level, unlinking marked nodes on the way
+    void find(const Node* target, Link** preds, Node** succs) {
+        while (!try_find(target, preds, succs)) {
+        }
+    }
+
+    // Claims the first linked, unclaimed node at or after curr on the bottom level
+    static Node* claim_from(Node* curr) noexcept {
+        while (curr) {
+            std::uintptr_t next = curr->next[0].load(std::memory_order_acquire);
+            if (!marked(next) && curr->linked.load(std::memory_order_acquire) &&
+                !curr->claimed.load(std::memory_order_relaxed) &&
+                !curr->claimed.exchange(true, std::memory_order_acq_rel)) {
+                return curr;
+            }
+            curr = pointer(next);
+        }
+        return nullptr;
+    }
+
+    // Random descent from spray_height_; returns where the bottom-level claim starts
+    Node* spray() noexcept {
+        Link* pred = head_;
+        for (int level = spray_height_; level >= 0; --level) {
+            auto steps = next_random() % static_cast<std::uint64_t>(spray_jump_ + 1);
+            Node* curr = pointer(pred[level].load(std::memory_order_acquire));
+            while (steps > 0 && curr) {
+                pred = curr->next;
+                curr = pointer(curr->next[level].load(std::memory_order_acquire));
+                --steps;
+            }
+        }
+        // Starting after the last node stepped on, rather than on it, keeps
+        // the walk from favouring tall nodes and thinning out the upper levels
+        return pointer(pred[0].load(std::memory_order_acquire));
+    }
+
+    // Unlinks a node this thread claimed and hands its contents out
+    std::pair<K, V> take(Node* node) {
+        // Marking top-down takes the node off the upper levels first
+        for (int level = node->height - 1; level >= 0; --level) {
+            node->next[level].fetch_or(1, std::memory_order_acq_rel);
+        }
+        Link* preds[kMaxHeight];
+        Node* succs[kMaxHeight];
+        find(node, preds, succs);
+
+        // Traversals may still compare against the key, so it is copied
+        std::pair<K, V> result(node->key, std::move(node->value));
+        size_.add(-1);
+        EpochDomain::retire(node, &reclaim_node);
+        return result;
+    }
+
+public:
+    /**
+     * @brief Constructs an empty priority queue
+     *
+     * @param spray_threads Expected number of concurrent consumers; sizes the
+     *        random walk of try_pop_relaxed()
+     * @param compare Key ordering
+     */
+    explicit ConcurrentPriorityQueue(std::size_t spray_threads = std::thread::hardware_concurrency(),
+                                     Compare compare = Compare())
+        : compare_(std::move(compare)) {
+        int log_threads = 0;
+        while ((std::size_t{2} << log_threads) <= spray_threads) {
+            ++log_threads;
+        }
+        // Each level skips about four times as many elements as the one below
+        spray_height_ = std::min(log_threads / 2, kMaxHeight - 1);
+        spray_jump_ = log_threads + 1;
+    }
+
+    /**
+     * @brief Destructor - not thread-safe, destroys remaining elements
+     */
+    ~ConcurrentPriorityQueue() {
+        Node* curr = pointer(head_[0].load(std::memory_order_relaxed));
+        while (curr) {
+            Node* next = pointer(curr->next[0].load(std::memory_order_relaxed));
+            deallocate_node(curr);
+            curr = next;
+        }
+    }
+
+    // Non-copyable, non-movable
+    ConcurrentPriorityQueue(const ConcurrentPriorityQueue&) = delete;
+    ConcurrentPriorityQueue& operator=(const ConcurrentPriorityQueue&) = delete;
+    ConcurrentPriorityQueue(ConcurrentPriorityQueue&&) = delete;
+    ConcurrentPriorityQueue& operator=(ConcurrentPriorityQueue&&) = delete;
+
+    /**
+     * @brief Inserts a value with the given priority
+     *
+     * Equal keys are allowed; their relative pop order is unspecified.
+     *
+     * @param key Priority of the value
+     * @param value The value to insert (will be moved)
+     */
+    void push(K key, V value) {
+        int height = random_height();
+        void* memory = NodePool<Node>::allocate();
+        Node* node;
+        try {
+            node = new (memory) Node(height, std::move(key), std::move(value));
+        } catch (...) {
+            NodePool<Node>::deallocate(static_cast<Node*>(memory));
+            throw;
+        }
+
+        EpochDomain::Guard guard;
+        Link* preds[kMaxHeight];
+        Node* succs[kMaxHeight];
+        while (true) {
+            find(node, preds, succs);
+            node->next[0].store(word(succs[0]), std::memory_order_relaxed);
+            std::uintptr_t expected = word(succs[0]);
+            if (preds[0][0].compare_exchange_strong(expected, word(node), std::memory_order_release,
+                                                    std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        size_.add(1);
+
+        // The node cannot be claimed before it is linked everywhere, so no
+        // one else writes its upper links in the meantime
+        for (int level = 1; level < height; ++level) {
+            while (true) {
+                node->next[level].store(word(succs[level]), std::memory_order_relaxed);
+                std::uintptr_t expected = word(succs[level]);
+                if (preds[level][level].compare_exchange_strong(expected, word(node),
+                                                                std::memory_order_release,
+                                                                std::memory_order_relaxed)) {
+                    break;
+                }
+                find(node, preds, succs);
+            }
+        }
+        node->linked.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Removes the element with the smallest key
+     *
+     * @return The key and value, empty if the queue is empty
+     */
+    std::optional<std::pair<K, V>> try_pop() {
+        EpochDomain::Guard guard;
+        Node* node = claim_from(pointer(head_[0].load(std::memory_order_acquire)));
+        if (!node) {
+            return std::nullopt;
+        }
+        return take(node);
+    }
+
+    /**
+     * @brief Removes an element with one of the smallest keys
+     *
+     * Spreads concurrent consumers over the front of the queue instead of
+     * making them all contend for the minimum. Falls back to an exact pop if
+     * the walk lands past the last unclaimed element.
+     *
+     * @return The key and value, empty if the queue is empty
+     */
+    std::optional<std::pair<K, V>> try_pop_relaxed() {
+        EpochDomain::Guard guard;
+        Node* node = claim_from(spray());
+        if (!node) {
+            node = claim_from(pointer(head_[0].load(std::memory_order_acquire)));
+            if (!node) {
+                return std::nullopt;
+            }
+        }
+        return take(node);
+    }
+
+    /**
+     * @brief Checks if the queue is empty
+     *
+     * @note This is a snapshot and may be outdated immediately
+     * @return true if no unclaimed element was found, false otherwise
+     */
+    bool empty() const noexcept {
+        EpochDomain::Guard guard;
+        Node* curr = pointer(head_[0].load(std::memory_order_acquire));
+        while (curr) {
+            if (!curr->claimed.load(std::memory_order_acquire)) {
+                return false;
+            }
+            curr = pointer(curr->next[0].load(std::memory_order_acquire));
+        }
+        return true;
+    }
+
+    /**
+     * @brief Gets the approximate number of elements
+     *
+     * @return Number of elements (snapshot)
+     */
+    std::size_t approximate_size() const noexcept {
+        std::int64_t size = size_.sum();
+        return size > 0 ? static_cast<std::size_t>(size) : 0;
+    }
+};
+
+} // namespace concurrent
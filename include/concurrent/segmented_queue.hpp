@@ -0,0 +1,291 @@
+#pragma once
+
+#include "epoch.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace concurrent {
+
+/**
+ * @brief Unbounded MPMC queue built from linked arrays of slots
+ *
+ * Follows the FAA-array design: each segment holds SegmentSize slots and two
+ * indices, and producers and consumers claim slots with a fetch_add on the
+ * segment's enqueue or dequeue index instead of a CAS on a shared pointer.
+ * fetch_add always succeeds, so contention does not turn into retries, and
+ * consecutive elements share cache lines instead of living in separate nodes.
+ *
+ * A consumer that reaches a slot before its producer marks it as taken; the
+ * producer then claims a fresh index. When a segment is exhausted a new one
+ * is linked, and the old one is retired through the Reclaimer once consumers
+ * move past it. A few freed segments are kept for reuse, so a queue in steady
+ * state does not go back to the system allocator for each new segment.
+ *
+ * @tparam T The type of elements stored in the queue
+ * @tparam Reclaimer Memory reclamation policy for exhausted segments
+ *         (EpochDomain or HazardPointerDomain)
+ * @tparam SegmentSize Number of slots per segment
+ */
+template<typename T, typename Reclaimer = EpochDomain, std::size_t SegmentSize = 1024>
+class SegmentedQueue {
+    static_assert(std::is_move_constructible_v<T>, "T must be move constructible");
+    static_assert(SegmentSize >= 2, "segments need at least two slots");
+
+private:
+    // Slot lifecycle: a producer moves it kEmpty -> kWriting -> kReady and the
+    // consumer moves kReady -> kTaken. A consumer that arrives first moves
+    // kEmpty -> kTaken, which makes the producer retry elsewhere.
+    enum SlotState : std::uint32_t {
+        kEmpty = 0,
+        kWriting = 1,
+        kReady = 2,
+        kTaken = 3,
+    };
+
+    struct Slot {
+        std::atomic<std::uint32_t> state{kEmpty};
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    struct Segment {
+        alignas(64) std::atomic<std::size_t> deq_idx{0};
+        alignas(64) std::atomic<std::size_t> enq_idx{0};
+        alignas(64) std::atomic<Segment*> next{nullptr};
+        std::uint64_t id; // Position in the chain, used for size estimates
+        Slot slots[SegmentSize];
+
+        explicit Segment(std::uint64_t segment_id) : id(segment_id) {}
+    };
+
+    alignas(64) std::atomic<Segment*> head_;
+    alignas(64) std::atomic<Segment*> tail_;
+
+    // Freed segments kept for reuse, shared by every queue of this type. A
+    // segment is taken or returned with one exchange/CAS on a slot, as in
+    // SlabPool's depot, so there is no ABA problem. SlabPool itself is not
+    // used: it carves dozens of blocks per slab and caches batches per
+    // thread, which for segment-sized blocks pins megabytes.
+    static constexpr std::size_t kCachedSegments = 4;
+    inline static std::atomic<void*> spare_segments_[kCachedSegments] = {};
+
+    static Segment* allocate_segment(std::uint64_t id) {
+        void* memory = nullptr;
+        for (auto& slot : spare_segments_) {
+            if (slot.load(std::memory_order_relaxed) &&
+                (memory = slot.exchange(nullptr, std::memory_order_acquire))) {
+                break;
+            }
+        }
+        if (!memory) {
+            memory = ::operator new(sizeof(Segment), std::align_val_t{alignof(Segment)});
+        }
+        return new (memory) Segment(id);
+    }
+
+    static void deallocate_segment(Segment* segment) {
+        segment->~Segment();
+        void* memory = segment;
+        for (auto& slot : spare_segments_) {
+            void* expected = nullptr;
+            if (slot.load(std::memory_order_relaxed) == nullptr &&
+                slot.compare_exchange_strong(expected, memory, std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+                return;
+            }
+        }
+        ::operator delete(memory, std::align_val_t{alignof(Segment)});
+    }
+
+    // Deleter handed to the reclamation domain; every slot is consumed or taken
+    static void reclaim_segment(void* segment) {
+        deallocate_segment(static_cast<Segment*>(segment));
+    }
+
+    // Slots of a segment that have been claimed, capped at the segment size
+    static std::size_t claimed(const std::atomic<std::size_t>& index) noexcept {
+        std::size_t idx = index.load(std::memory_order_acquire);
+        return idx < SegmentSize ? idx : SegmentSize;
+    }
+
+public:
+    /**
+     * @brief Constructs an empty queue
+     */
+    SegmentedQueue() {
+        Segment* first = allocate_segment(0);
+        head_.store(first, std::memory_order_relaxed);
+        tail_.store(first, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Destructor - not thread-safe, destroys remaining elements
+     */
+    ~SegmentedQueue() {
+        Segment* segment = head_.load(std::memory_order_relaxed);
+        while (segment) {
+            for (Slot& slot : segment->slots) {
+                if (slot.state.load(std::memory_order_relaxed) == kReady) {
+                    slot.value()->~T();
+                }
+            }
+            Segment* next = segment->next.load(std::memory_order_relaxed);
+            deallocate_segment(segment);
+            segment = next;
+        }
+    }
+
+    // Non-copyable, non-movable
+    SegmentedQueue(const SegmentedQueue&) = delete;
+    SegmentedQueue& operator=(const SegmentedQueue&) = delete;
+    SegmentedQueue(SegmentedQueue&&) = delete;
+    SegmentedQueue& operator=(SegmentedQueue&&) = delete;
+
+    /**
+     * @brief Enqueues an item into the queue
+     *
+     * @param item The item to enqueue (will be moved)
+     * @return true (the queue is unbounded)
+     */
+    bool enqueue(T item) {
+        typename Reclaimer::Guard guard;
+        while (true) {
+            Segment* tail = guard.protect(0, tail_);
+            std::size_t idx = tail->enq_idx.fetch_add(1, std::memory_order_acq_rel);
+
+            if (idx >= SegmentSize) {
+                // Segment exhausted: link a new one or help the producer that did
+                Segment* next = guard.protect(1, tail->next);
+                if (tail_.load(std::memory_order_acquire) != tail) {
+                    continue;
+                }
+                if (next == nullptr) {
+                    Segment* fresh = allocate_segment(tail->id + 1);
+                    Segment* expected = nullptr;
+                    if (tail->next.compare_exchange_strong(expected, fresh,
+                                                           std::memory_order_acq_rel)) {
+                        next = fresh;
+                    } else {
+                        deallocate_segment(fresh);
+                        next = expected;
+                    }
+                }
+                tail_.compare_exchange_strong(tail, next, std::memory_order_acq_rel);
+                continue;
+            }
+
+            Slot& slot = tail->slots[idx];
+            std::uint32_t expected = kEmpty;
+            if (!slot.state.compare_exchange_strong(expected, kWriting,
+                                                    std::memory_order_acquire)) {
+                continue; // A consumer gave up on this slot
+            }
+            try {
+                new (slot.storage) T(std::move(item));
+            } catch (...) {
+                slot.state.store(kTaken, std::memory_order_release);
+                throw;
+            }
+            slot.state.store(kReady, std::memory_order_release);
+            return true;
+        }
+    }
+
+    /**
+     * @brief Attempts to dequeue an item from the queue
+     *
+     * @return std::optional<T> containing the item if available, empty otherwise
+     */
+    std::optional<T> dequeue() {
+        typename Reclaimer::Guard guard;
+        while (true) {
+            Segment* head = guard.protect(0, head_);
+
+            // Do not burn indices on an empty queue
+            if (head->deq_idx.load(std::memory_order_acquire) >=
+                    head->enq_idx.load(std::memory_order_acquire) &&
+                head->next.load(std::memory_order_acquire) == nullptr) {
+                return std::nullopt;
+            }
+
+            std::size_t idx = head->deq_idx.fetch_add(1, std::memory_order_acq_rel);
+            if (idx >= SegmentSize) {
+                Segment* next = guard.protect(1, head->next);
+                if (head_.load(std::memory_order_acquire) != head) {
+                    continue;
+                }
+                if (next == nullptr) {
+                    return std::nullopt;
+                }
+                // Never retire a segment tail_ still points to
+                Segment* tail = head;
+                tail_.compare_exchange_strong(tail, next, std::memory_order_acq_rel);
+                if (head_.compare_exchange_strong(head, next, std::memory_order_acq_rel)) {
+                    Reclaimer::retire(head, &reclaim_segment);
+                }
+                continue;
+            }
+
+            Slot& slot = head->slots[idx];
+            std::uint32_t state = slot.state.load(std::memory_order_acquire);
+            if (state == kEmpty &&
+                slot.state.compare_exchange_strong(state, kTaken, std::memory_order_acq_rel)) {
+                continue; // Producer has not arrived; it will retry elsewhere
+            }
+            while (state == kWriting) {
+                // The producer owns the slot and is constructing the element
+                std::this_thread::yield();
+                state = slot.state.load(std::memory_order_acquire);
+            }
+            if (state != kReady) {
+                continue; // Producer's constructor threw
+            }
+
+            std::optional<T> result(std::in_place, std::move(*slot.value()));
+            slot.value()->~T();
+            slot.state.store(kTaken, std::memory_order_relaxed);
+            return result;
+        }
+    }
+
+    /**
+     * @brief Checks if the queue is empty
+     *
+     * @note This is a snapshot and may be outdated immediately
+     * @return true if queue appears empty, false otherwise
+     */
+    bool empty() const noexcept {
+        return approximate_size() == 0;
+    }
+
+    /**
+     * @brief Gets the approximate size of the queue
+     *
+     * Computed from the head and tail segment indices in O(1). Slots that
+     * consumers skipped still count until the segment is exhausted.
+     *
+     * @return Approximate number of elements
+     */
+    size_t approximate_size() const noexcept {
+        typename Reclaimer::Guard guard;
+        Segment* head = guard.protect(0, head_);
+        Segment* tail = guard.protect(1, tail_);
+        if (tail->id < head->id) {
+            return 0; // Consumers overtook a lagging tail
+        }
+        std::size_t enqueued = (tail->id - head->id) * SegmentSize + claimed(tail->enq_idx);
+        std::size_t dequeued = claimed(head->deq_idx);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+};
+
+} // namespace concurrent
@@ -0,0 +1,402 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace concurrent {
+
+namespace detail {
+
+// Identifies this process to others sharing a region
+std::uint32_t current_process_id() noexcept;
+
+// False only once the process is known to be gone; pid is read in the
+// caller's pid namespace
+bool process_exists(std::uint32_t pid) noexcept;
+
+} // namespace detail
+
+/**
+ * @brief Owning handle to a shared memory mapping (POSIX)
+ *
+ * Wraps a memfd_create() or shm_open() file descriptor together with its
+ * MAP_SHARED mapping. The mapping survives fork(), and another process can
+ * map the same memory by name or through the descriptor, usually at a
+ * different address. Errors are reported as std::system_error.
+ */
+class SharedMemory {
+public:
+    SharedMemory() = default;
+
+    /**
+     * @brief Creates anonymous zero-filled shared memory (Linux memfd)
+     *
+     * Shared with children through fork(), or with other processes by
+     * passing fd() and calling attach().
+     *
+     * @param size Size in bytes
+     * @param name Label shown in /proc, need not be unique
+     */
+    static SharedMemory create_anonymous(std::size_t size, const char* name = "concurrent");
+
+    /**
+     * @brief Opens or creates named shared memory (shm_open)
+     *
+     * Memory is zero-filled when created. If it exists but is smaller than
+     * @p size, it is grown.
+     *
+     * @param name Name starting with '/', e.g. "/my-queue"
+     * @param size Size in bytes
+     */
+    static SharedMemory open(const std::string& name, std::size_t size);
+
+    /**
+     * @brief Maps the whole of an existing shared memory descriptor
+     *
+     * @param fd Descriptor from another SharedMemory; duplicated, not adopted
+     */
+    static SharedMemory attach(int fd);
+
+    /**
+     * @brief Removes a name created by open(); existing mappings stay valid
+     */
+    static void unlink(const std::string& name) noexcept;
+
+    SharedMemory(SharedMemory&& other) noexcept
+        : fd_(std::exchange(other.fd_, -1)),
+          data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    SharedMemory& operator=(SharedMemory&& other) noexcept {
+        if (this != &other) {
+            release();
+            fd_ = std::exchange(other.fd_, -1);
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    SharedMemory(const SharedMemory&) = delete;
+    SharedMemory& operator=(const SharedMemory&) = delete;
+
+    /**
+     * @brief Unmaps the memory and closes the descriptor
+     */
+    ~SharedMemory() {
+        release();
+    }
+
+    void* data() const noexcept {
+        return data_;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    int fd() const noexcept {
+        return fd_;
+    }
+
+private:
+    SharedMemory(int fd, std::size_t size); // Maps fd, closing it on failure
+    void release() noexcept;
+
+    int fd_ = -1;
+    void* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/**
+ * @brief Bounded MPMC queue that lives in shared memory, for use across processes
+ *
+ * The same sequence-slot ring as BoundedQueue, laid out in a SharedMemory
+ * mapping instead of the heap. Processes map the region at different
+ * addresses, so nothing inside it is a pointer: the slot array is found
+ * through an offset stored in the header, and elements must be trivially
+ * copyable (no pointers into one process's heap).
+ *
+ * Positions and slot sequences are fixed-width 64-bit, address-free
+ * lock-free atomics rather than process-private locks. They never wrap in
+ * practice, read the same from 32- and 64-bit processes, and a process
+ * that dies never leaves a lock held. A process killed between claiming a
+ * slot and publishing it (a copy of T) does stall that slot for everyone.
+ *
+ * The first process to attach initializes the region and records its pid;
+ * later ones wait for that and check that the region was laid out for the
+ * same T and Capacity. Initializing is idempotent, so if the initializer
+ * dies part-way the next attacher takes over instead of waiting forever;
+ * one that stays alive but does not finish within ten seconds makes
+ * attach() throw.
+ *
+ * @warning The recorded pid is only meaningful if every process attaching
+ * the region shares one pid namespace (e.g. not separate containers). In
+ * another namespace a live initializer may be judged dead and taken over,
+ * and an unrelated process may be waited on until the timeout.
+ *
+ * @tparam T Trivially copyable element type
+ * @tparam Capacity Number of slots (must be a power of two)
+ */
+template<typename T, std::size_t Capacity>
+class SharedBoundedQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free &&
+                      std::atomic_ref<std::uint64_t>::is_always_lock_free,
+                  "shared atomics must be lock-free to be address-free");
+
+private:
+    static constexpr std::uint32_t kMagic = 0x43535142; // "CSQB"
+    static constexpr std::uint32_t kFresh = 0;          // Zero-filled new memory
+    static constexpr std::uint32_t kInitializing = 1;
+    static constexpr std::uint32_t kReady = 2;
+    static constexpr auto kInitTimeout = std::chrono::seconds(10);
+    static constexpr std::size_t kMask = Capacity - 1;
+
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> sequence;
+        T value;
+    };
+
+    // Region layout; only what the initializer constructs is ever used as an object
+    struct Header {
+        // Initializer's pid << 32 | state, accessed through atomic_ref before
+        // anything is constructed
+        std::uint64_t state;
+        std::uint32_t magic;
+        std::uint64_t capacity;
+        std::uint64_t element_size;
+        std::uint64_t slots_offset; // From the start of the region
+        alignas(64) std::atomic<std::uint64_t> enqueue_pos;
+        alignas(64) std::atomic<std::uint64_t> dequeue_pos;
+    };
+
+    static constexpr std::size_t kSlotsOffset = (sizeof(Header) + alignof(Slot) - 1) &
+                                                ~(alignof(Slot) - 1);
+
+    SharedMemory memory_;
+    Header* header_ = nullptr;
+    Slot* slots_ = nullptr;
+
+    static Header* header_at(void* base) noexcept {
+        return static_cast<Header*>(base);
+    }
+
+    static std::uint64_t state_word(std::uint32_t pid, std::uint32_t state) noexcept {
+        return (static_cast<std::uint64_t>(pid) << 32) | state;
+    }
+
+    void initialize(unsigned char* base) noexcept {
+        header_->magic = kMagic;
+        header_->capacity = Capacity;
+        header_->element_size = sizeof(T);
+        header_->slots_offset = kSlotsOffset;
+        new (&header_->enqueue_pos) std::atomic<std::uint64_t>(0);
+        new (&header_->dequeue_pos) std::atomic<std::uint64_t>(0);
+        auto* slots = reinterpret_cast<Slot*>(base + kSlotsOffset);
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            new (&slots[i].sequence) std::atomic<std::uint64_t>(i);
+        }
+    }
+
+    // Initializes fresh memory, waits for whoever else is doing so, or takes
+    // over from an initializer that died
+    void attach() {
+        if (memory_.size() < region_size()) {
+            throw std::invalid_argument("shared memory too small for SharedBoundedQueue");
+        }
+        auto* base = static_cast<unsigned char*>(memory_.data());
+        header_ = header_at(base);
+        std::atomic_ref<std::uint64_t> state(header_->state);
+        const std::uint64_t mine = state_word(detail::current_process_id(), kInitializing);
+        const auto deadline = std::chrono::steady_clock::now() + kInitTimeout;
+        std::uint64_t word = state.load(std::memory_order_acquire);
+        while (true) {
+            auto phase = static_cast<std::uint32_t>(word);
+            if (phase == kReady) {
+                break;
+            }
+            if (phase == kFresh ||
+                (phase == kInitializing &&
+                 !detail::process_exists(static_cast<std::uint32_t>(word >> 32)))) {
+                if (state.compare_exchange_strong(word, mine, std::memory_order_acquire)) {
+                    initialize(base);
+                    // Fails only if we were taken for dead: the new owner redoes
+                    // the same initialization, so wait for it like anyone else
+                    word = mine;
+                    if (state.compare_exchange_strong(word, kReady, std::memory_order_release,
+                                                      std::memory_order_acquire)) {
+                        break;
+                    }
+                }
+                continue; // word now holds what beat us to it
+            }
+            if (phase != kInitializing) {
+                throw std::runtime_error("shared memory holds no SharedBoundedQueue");
+            }
+            if (std::chrono::steady_clock::now() > deadline) {
+                throw std::runtime_error("timed out waiting for SharedBoundedQueue initializer");
+            }
+            std::this_thread::yield();
+            word = state.load(std::memory_order_acquire);
+        }
+        if (header_->magic != kMagic || header_->capacity != Capacity ||
+            header_->element_size != sizeof(T)) {
+            throw std::runtime_error("shared memory holds a different SharedBoundedQueue");
+        }
+        slots_ = std::launder(reinterpret_cast<Slot*>(base + header_->slots_offset));
+    }
+
+public:
+    /**
+     * @brief Gets the number of bytes of shared memory the queue needs
+     */
+    static constexpr std::size_t region_size() noexcept {
+        return kSlotsOffset + Capacity * sizeof(Slot);
+    }
+
+    /**
+     * @brief Creates a queue in new anonymous shared memory (Linux)
+     *
+     * Child processes forked afterwards share the queue.
+     */
+    static SharedBoundedQueue create_anonymous() {
+        return SharedBoundedQueue(SharedMemory::create_anonymous(region_size(), "shared_queue"));
+    }
+
+    /**
+     * @brief Opens the queue with the given name, creating it if needed
+     *
+     * @param name shm_open() name starting with '/'; see SharedMemory::unlink()
+     */
+    static SharedBoundedQueue open(const std::string& name) {
+        return SharedBoundedQueue(SharedMemory::open(name, region_size()));
+    }
+
+    /**
+     * @brief Attaches to a queue in the given mapping, initializing it if fresh
+     *
+     * @param memory Zero-filled or queue-holding memory of at least region_size() bytes
+     */
+    explicit SharedBoundedQueue(SharedMemory memory) : memory_(std::move(memory)) {
+        attach();
+    }
+
+    // A handle: movable, the queue itself stays in shared memory
+    SharedBoundedQueue(SharedBoundedQueue&&) noexcept = default;
+    SharedBoundedQueue& operator=(SharedBoundedQueue&&) noexcept = default;
+    SharedBoundedQueue(const SharedBoundedQueue&) = delete;
+    SharedBoundedQueue& operator=(const SharedBoundedQueue&) = delete;
+
+    /**
+     * @brief Attempts to enqueue a copy of an item
+     *
+     * @param item The item to copy into shared memory
+     * @return true if enqueued, false if the queue is full
+     */
+    bool try_enqueue(const T& item) noexcept {
+        std::uint64_t pos = header_->enqueue_pos.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots_[pos & kMask];
+            std::uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::int64_t>(seq - pos);
+            if (diff == 0) {
+                if (header_->enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                                               std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // Slot still holds last lap's element: full
+            } else {
+                pos = header_->enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::memcpy(&slot->value, &item, sizeof(T));
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Attempts to dequeue an item
+     *
+     * @return std::optional<T> containing the item, empty if the queue is empty
+     */
+    std::optional<T> try_dequeue() noexcept {
+        std::uint64_t pos = header_->dequeue_pos.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots_[pos & kMask];
+            std::uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::int64_t>(seq - (pos + 1));
+            if (diff == 0) {
+                if (header_->dequeue_pos.compare_exchange_weak(pos, pos + 1,
+                                                               std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return std::nullopt; // Slot not yet filled for this lap: empty
+            } else {
+                pos = header_->dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::optional<T> result(std::in_place);
+        std::memcpy(&*result, &slot->value, sizeof(T));
+        // Hand the slot to the producer of the next lap
+        slot->sequence.store(pos + Capacity, std::memory_order_release);
+        return result;
+    }
+
+    /**
+     * @brief Checks if the queue is empty
+     *
+     * @note This is a snapshot and may be outdated immediately
+     * @return true if queue appears empty, false otherwise
+     */
+    bool empty() const noexcept {
+        return approximate_size() == 0;
+    }
+
+    /**
+     * @brief Gets the approximate number of elements
+     *
+     * @return Number of claimed slots not yet dequeued (snapshot)
+     */
+    std::size_t approximate_size() const noexcept {
+        std::uint64_t tail = header_->enqueue_pos.load(std::memory_order_acquire);
+        std::uint64_t head = header_->dequeue_pos.load(std::memory_order_acquire);
+        return tail > head ? static_cast<std::size_t>(tail - head) : 0;
+    }
+
+    /**
+     * @brief Gets the fixed capacity
+     *
+     * @return Number of slots
+     */
+    static constexpr std::size_t capacity() noexcept {
+        return Capacity;
+    }
+
+    /**
+     * @brief Gets the underlying shared memory, e.g. to pass its fd() on
+     */
+    const SharedMemory& memory() const noexcept {
+        return memory_;
+    }
+};
+
+} // namespace concurrent
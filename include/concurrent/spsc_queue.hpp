@@ -0,0 +1,248 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace concurrent {
+
+/**
+ * @brief Wait-free single-producer single-consumer ring buffer
+ *
+ * Exactly one thread may enqueue and exactly one thread may dequeue. Each side
+ * owns one index and keeps a private cached copy of the other side's index, so
+ * the shared cache line of the opposite index is only read when the cached
+ * value says the queue looks full (producer) or empty (consumer). The hot path
+ * is a plain load, a store into the slot and one release store.
+ *
+ * The bulk operations move a whole batch with a single index publication.
+ *
+ * @tparam T The type of elements stored in the queue
+ */
+template<typename T>
+class SpscQueue {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "T must be nothrow move constructible");
+
+private:
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    static constexpr std::size_t kCacheLine = 64;
+
+    static std::size_t round_up_pow2(std::size_t n) noexcept {
+        std::size_t capacity = 2;
+        while (capacity < n) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+    // Producer line: written only by the producer
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};
+    std::size_t cached_head_ = 0;
+
+    // Consumer line: written only by the consumer
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};
+    std::size_t cached_tail_ = 0;
+
+    // Free slots visible to the producer, refreshing the cached head if needed
+    std::size_t free_slots(std::size_t tail, std::size_t wanted) noexcept {
+        std::size_t free = capacity_ - (tail - cached_head_);
+        if (free < wanted) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            free = capacity_ - (tail - cached_head_);
+        }
+        return free;
+    }
+
+    // Filled slots visible to the consumer, refreshing the cached tail if needed
+    std::size_t filled_slots(std::size_t head, std::size_t wanted) noexcept {
+        std::size_t filled = cached_tail_ - head;
+        if (filled < wanted) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            filled = cached_tail_ - head;
+        }
+        return filled;
+    }
+
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (free_slots(tail, 1) == 0) {
+            return false;
+        }
+        new (slots_[tail & mask_].storage) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+public:
+    /**
+     * @brief Constructs an empty queue
+     *
+     * @param capacity Minimum number of elements; rounded up to a power of two
+     */
+    explicit SpscQueue(std::size_t capacity = 1024)
+        : capacity_(round_up_pow2(capacity)),
+          mask_(capacity_ - 1),
+          slots_(new Slot[capacity_]) {}
+
+    /**
+     * @brief Destructor - not thread-safe, destroys remaining elements
+     */
+    ~SpscQueue() {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        for (std::size_t pos = head_.load(std::memory_order_relaxed); pos != tail; ++pos) {
+            slots_[pos & mask_].value()->~T();
+        }
+    }
+
+    // Non-copyable, non-movable
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+    SpscQueue(SpscQueue&&) = delete;
+    SpscQueue& operator=(SpscQueue&&) = delete;
+
+    /**
+     * @brief Attempts to enqueue an item (producer only)
+     *
+     * @param item The item to move into the queue (left untouched on failure)
+     * @return true if enqueued, false if the queue is full
+     */
+    bool try_enqueue(T&& item) {
+        return emplace(std::move(item));
+    }
+
+    /**
+     * @brief Attempts to enqueue a copy of an item (producer only)
+     *
+     * @param item The item to copy into the queue
+     * @return true if enqueued, false if the queue is full
+     */
+    bool try_enqueue(const T& item) {
+        return emplace(item);
+    }
+
+    /**
+     * @brief Enqueues as many items from a range as fit (producer only)
+     *
+     * All accepted items become visible to the consumer at once.
+     *
+     * @param first Iterator to the first item; items are moved from
+     * @param count Number of items available at @p first
+     * @return Number of items enqueued (a prefix of the range)
+     */
+    template<typename It>
+    std::size_t try_enqueue_bulk(It first, std::size_t count) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        const std::size_t n = std::min(count, free_slots(tail, count));
+        for (std::size_t i = 0; i < n; ++i, ++first) {
+            if constexpr (std::is_nothrow_constructible_v<T, decltype(std::move(*first))>) {
+                new (slots_[(tail + i) & mask_].storage) T(std::move(*first));
+            } else {
+                try {
+                    new (slots_[(tail + i) & mask_].storage) T(std::move(*first));
+                } catch (...) {
+                    // Publish what was built so the queue stays consistent
+                    tail_.store(tail + i, std::memory_order_release);
+                    throw;
+                }
+            }
+        }
+        tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    /**
+     * @brief Attempts to dequeue an item (consumer only)
+     *
+     * @return std::optional<T> containing the item, empty if the queue is empty
+     */
+    std::optional<T> try_dequeue() {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (filled_slots(head, 1) == 0) {
+            return std::nullopt;
+        }
+        T* value = slots_[head & mask_].value();
+        std::optional<T> result(std::in_place, std::move(*value));
+        value->~T();
+        head_.store(head + 1, std::memory_order_release);
+        return result;
+    }
+
+    /**
+     * @brief Dequeues up to @p max items into an output iterator (consumer only)
+     *
+     * The freed slots are handed back to the producer at once.
+     *
+     * @param out Output iterator receiving the items by move
+     * @param max Maximum number of items to dequeue
+     * @return Number of items dequeued
+     */
+    template<typename OutIt>
+    std::size_t try_dequeue_bulk(OutIt out, std::size_t max) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        const std::size_t n = std::min(max, filled_slots(head, max));
+        for (std::size_t i = 0; i < n; ++i) {
+            T* value = slots_[(head + i) & mask_].value();
+            try {
+                *out = std::move(*value);
+                ++out;
+            } catch (...) {
+                // Items before this one are consumed; this one stays queued
+                head_.store(head + i, std::memory_order_release);
+                throw;
+            }
+            value->~T();
+        }
+        head_.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    /**
+     * @brief Checks if the queue is empty
+     *
+     * @note This is a snapshot and may be outdated immediately
+     * @return true if queue appears empty, false otherwise
+     */
+    bool empty() const noexcept {
+        return approximate_size() == 0;
+    }
+
+    /**
+     * @brief Gets the approximate number of elements
+     *
+     * @return Number of elements enqueued and not yet dequeued (snapshot)
+     */
+    std::size_t approximate_size() const noexcept {
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    /**
+     * @brief Gets the capacity
+     *
+     * @return Number of slots (a power of two)
+     */
+    std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+};
+
+} // namespace concurrent
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace concurrent {
+
+/**
+ * @brief Contention-free approximate counter
+ *
+ * Updates go to one of kStripes cache-line padded cells, chosen per thread,
+ * so concurrent writers rarely share a line. Reads sum every cell and are
+ * O(kStripes); the result is exact once writers are quiescent and otherwise
+ * a snapshot that may lag concurrent updates.
+ */
+class StripedCounter {
+public:
+    static constexpr std::size_t kStripes = 16;
+
+    StripedCounter() = default;
+
+    StripedCounter(const StripedCounter&) = delete;
+    StripedCounter& operator=(const StripedCounter&) = delete;
+
+    /**
+     * @brief Adds @p delta to the calling thread's stripe
+     *
+     * @param delta Amount to add (may be negative)
+     * @param order Memory order of the update
+     */
+    void add(std::int64_t delta, std::memory_order order = std::memory_order_relaxed) noexcept {
+        stripes_[stripe_index()].value.fetch_add(delta, order);
+    }
+
+    /**
+     * @brief Sums all stripes
+     *
+     * @param order Memory order of each stripe load
+     * @return Current total (snapshot)
+     */
+    std::int64_t sum(std::memory_order order = std::memory_order_relaxed) const noexcept {
+        std::int64_t total = 0;
+        for (const Stripe& stripe : stripes_) {
+            total += stripe.value.load(order);
+        }
+        return total;
+    }
+
+private:
+    struct alignas(64) Stripe {
+        std::atomic<std::int64_t> value{0};
+    };
+
+    static constexpr std::size_t kUnassigned = ~std::size_t{0};
+
+    inline static std::atomic<std::size_t> next_index_{0};
+    // Constant-initialized so the hot path needs no TLS init guard
+    inline static thread_local std::size_t t_index_ = kUnassigned;
+
+    // Threads are spread over the stripes round-robin on first use
+    static std::size_t stripe_index() noexcept {
+        if (t_index_ == kUnassigned) {
+            t_index_ = next_index_.fetch_add(1, std::memory_order_relaxed) % kStripes;
+        }
+        return t_index_;
+    }
+
+    Stripe stripes_[kStripes];
+};
+
+} // namespace concurrent
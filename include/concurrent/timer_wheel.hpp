@@ -0,0 +1,413 @@
+#pragma once
+
+#include "event_count.hpp"
+#include "node_pool.hpp"
+#include "striped_counter.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace concurrent {
+
+/**
+ * @brief Delay queue built on a hierarchical timing wheel
+ *
+ * Any thread may schedule an item with a due time; one consumer thread pops
+ * the items whose time has come. Time is cut into ticks of a fixed
+ * resolution. Level 0 of the wheel has one slot per tick, and each level
+ * above has slots 64 times as wide, so eleven levels of 64 slots cover every
+ * 64-bit tick. An item sits on the level of the highest tick digit in which
+ * it differs from the current tick; when time reaches its slot, the slot is
+ * cascaded and its items move down, so each item is touched at most once per
+ * level. A bitmap of occupied slots per level lets the wheel jump straight
+ * to the next slot that has work instead of stepping through empty ticks.
+ *
+ * Scheduling threads never touch the wheel: they push onto a lock-free
+ * inbox stack, which the consumer takes whole with a single exchange.
+ *
+ * Items never expire early: they are popped by the first poll at or after
+ * their due time, at most one tick later. Items due at the same tick come
+ * out in no particular order.
+ *
+ * @tparam T Item type
+ */
+template<typename T>
+class TimerWheel {
+    static_assert(std::is_move_constructible_v<T>, "T must be move constructible");
+
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    static constexpr int kSlotBits = 6;
+    static constexpr std::size_t kSlots = std::size_t{1} << kSlotBits;
+    static constexpr int kLevels = (64 + kSlotBits - 1) / kSlotBits;
+    static constexpr std::uint64_t kNever = std::numeric_limits<std::uint64_t>::max();
+
+    struct Node {
+        Node* next = nullptr;
+        std::uint64_t due_tick;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    const Clock::time_point origin_; // Tick 0
+    const Clock::duration resolution_;
+
+    // Producer side
+    alignas(64) std::atomic<Node*> inbox_{nullptr};
+    alignas(64) EventCount inbox_ready_; // Parks the consumer of the blocking polls
+    StripedCounter size_;
+
+    // Consumer side
+    alignas(64) std::uint64_t current_tick_ = 0; // Every tick up to this one is processed
+    std::uint64_t occupied_[kLevels] = {};        // Bit s set if slots_[level][s] is non-empty
+    Node* slots_[kLevels][kSlots] = {};
+    Node* expired_head_ = nullptr; // Due items not yet handed out, in no order
+    Node* expired_tail_ = nullptr;
+
+    static void destroy_node(Node* node) noexcept {
+        node->value()->~T();
+        NodePool<Node>::deallocate(node);
+    }
+
+    static void destroy_list(Node* node) noexcept {
+        while (node) {
+            Node* next = node->next;
+            destroy_node(node);
+            node = next;
+        }
+    }
+
+    // First tick at or after time, so that items never fire early
+    std::uint64_t tick_at_or_after(Clock::time_point time) const noexcept {
+        if (time <= origin_) {
+            return 0;
+        }
+        auto elapsed = (time - origin_).count();
+        auto resolution = resolution_.count();
+        return static_cast<std::uint64_t>(elapsed / resolution + (elapsed % resolution != 0));
+    }
+
+    // Last tick that has fully started by time
+    std::uint64_t tick_before(Clock::time_point time) const noexcept {
+        if (time <= origin_) {
+            return 0;
+        }
+        return static_cast<std::uint64_t>((time - origin_).count() / resolution_.count());
+    }
+
+    Clock::time_point time_of(std::uint64_t tick) const noexcept {
+        return origin_ + resolution_ * static_cast<Clock::rep>(tick);
+    }
+
+    void push_expired(Node* node) noexcept {
+        node->next = nullptr;
+        if (expired_tail_) {
+            expired_tail_->next = node;
+        } else {
+            expired_head_ = node;
+        }
+        expired_tail_ = node;
+    }
+
+    // Files a node under the highest tick digit in which it differs from now
+    void insert(Node* node) noexcept {
+        if (node->due_tick <= current_tick_) {
+            push_expired(node);
+            return;
+        }
+        int level = (std::bit_width(node->due_tick ^ current_tick_) - 1) / kSlotBits;
+        auto slot = static_cast<std::size_t>((node->due_tick >> (level * kSlotBits)) & (kSlots - 1));
+        node->next = slots_[level][slot];
+        slots_[level][slot] = node;
+        occupied_[level] |= std::uint64_t{1} << slot;
+    }
+
+    // Tick at which the first occupied slot of a level comes due. Every
+    // occupied slot is ahead of the current digit on its level and shares
+    // the digits above it, so the lowest set bit is the next one.
+    std::uint64_t level_event(int level) const noexcept {
+        if (occupied_[level] == 0) {
+            return kNever;
+        }
+        int shift = level * kSlotBits;
+        int above = shift + kSlotBits;
+        std::uint64_t prefix = above < 64 ? (current_tick_ >> above) << above : 0;
+        return prefix | (static_cast<std::uint64_t>(std::countr_zero(occupied_[level])) << shift);
+    }
+
+    std::uint64_t next_event() const noexcept {
+        std::uint64_t next = kNever;
+        for (int level = 0; level < kLevels; ++level) {
+            next = std::min(next, level_event(level));
+        }
+        return next;
+    }
+
+    // Moves time forward to target, expiring and cascading slots on the way
+    void advance(std::uint64_t target) noexcept {
+        while (true) {
+            std::uint64_t tick = next_event();
+            if (tick > target) {
+                current_tick_ = std::max(current_tick_, target);
+                return;
+            }
+            current_tick_ = tick;
+            // Top-down, so cascaded items due now are expired in this pass
+            for (int level = kLevels - 1; level >= 0; --level) {
+                if (level_event(level) != tick) {
+                    continue;
+                }
+                auto slot = static_cast<std::size_t>(std::countr_zero(occupied_[level]));
+                Node* node = std::exchange(slots_[level][slot], nullptr);
+                occupied_[level] &= occupied_[level] - 1;
+                while (node) {
+                    Node* next = node->next;
+                    insert(node);
+                    node = next;
+                }
+            }
+        }
+    }
+
+    // Files everything the producers scheduled since the last call
+    void drain_inbox() noexcept {
+        Node* node = inbox_.exchange(nullptr, std::memory_order_acquire);
+        while (node) {
+            Node* next = node->next;
+            insert(node);
+            node = next;
+        }
+    }
+
+    template<typename F>
+    std::size_t wait_and_poll(const Clock::time_point* deadline, F& fn) {
+        while (true) {
+            if (std::size_t count = poll(fn)) {
+                return count;
+            }
+            EventCount::Key key = inbox_ready_.prepare_wait();
+            if (inbox_.load(std::memory_order_seq_cst) != nullptr) {
+                inbox_ready_.cancel_wait(); // Something new may be due sooner
+                continue;
+            }
+            std::optional<Clock::time_point> wake = next_expiry();
+            if (deadline && (!wake || *deadline < *wake)) {
+                wake = *deadline;
+            }
+            if (!wake) {
+                inbox_ready_.wait(key);
+            } else {
+                inbox_ready_.wait_until(key, *wake);
+            }
+            if (deadline && Clock::now() >= *deadline) {
+                return poll(fn);
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Constructs an empty wheel
+     *
+     * @param resolution Length of one tick; items may fire up to this much late
+     */
+    explicit TimerWheel(Clock::duration resolution = std::chrono::milliseconds(1))
+        : origin_(Clock::now()), resolution_(std::max(resolution, Clock::duration(1))) {}
+
+    /**
+     * @brief Destructor - not thread-safe, destroys items still scheduled
+     */
+    ~TimerWheel() {
+        destroy_list(inbox_.load(std::memory_order_relaxed));
+        destroy_list(expired_head_);
+        for (auto& level : slots_) {
+            for (Node* slot : level) {
+                destroy_list(slot);
+            }
+        }
+    }
+
+    // Non-copyable, non-movable
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+
+    /**
+     * @brief Schedules an item to become available at a point in time (any thread)
+     *
+     * @param item The item to schedule (will be moved)
+     * @param due Time from which the item can be popped; past times expire at the next poll
+     */
+    void schedule(T item, Clock::time_point due) {
+        Node* node = new (NodePool<Node>::allocate()) Node();
+        try {
+            new (node->storage) T(std::move(item));
+        } catch (...) {
+            NodePool<Node>::deallocate(node);
+            throw;
+        }
+        node->due_tick = tick_at_or_after(due);
+        size_.add(1);
+
+        node->next = inbox_.load(std::memory_order_relaxed);
+        // seq_cst so that a consumer parked in a blocking poll is not missed
+        while (!inbox_.compare_exchange_weak(node->next, node, std::memory_order_seq_cst,
+                                             std::memory_order_relaxed)) {
+        }
+        inbox_ready_.notify_one();
+    }
+
+    /**
+     * @brief Schedules an item to become available after a delay (any thread)
+     *
+     * @param item The item to schedule (will be moved)
+     * @param delay Time from now until the item can be popped
+     */
+    template<typename Rep, typename Period>
+    void schedule_after(T item, std::chrono::duration<Rep, Period> delay) {
+        schedule(std::move(item), Clock::now() + std::chrono::ceil<Clock::duration>(delay));
+    }
+
+    /**
+     * @brief Pops every item due at @p now (consumer only)
+     *
+     * @param now Current time; must not go backwards between calls
+     * @param fn Callable invoked as fn(T&&) for each expired item
+     * @return Number of items popped
+     */
+    template<typename F>
+    std::size_t poll(Clock::time_point now, F&& fn) {
+        drain_inbox();
+        advance(tick_before(now));
+
+        std::size_t count = 0;
+        while (Node* node = expired_head_) {
+            expired_head_ = node->next;
+            if (!expired_head_) {
+                expired_tail_ = nullptr;
+            }
+            size_.add(-1);
+            ++count;
+            try {
+                fn(std::move(*node->value()));
+            } catch (...) {
+                destroy_node(node);
+                throw;
+            }
+            destroy_node(node);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Pops every item that is due now (consumer only)
+     *
+     * @param fn Callable invoked as fn(T&&) for each expired item
+     * @return Number of items popped
+     */
+    template<typename F>
+    std::size_t poll(F&& fn) {
+        return poll(Clock::now(), fn);
+    }
+
+    /**
+     * @brief Waits until at least one item is due and pops every due item (consumer only)
+     *
+     * Sleeps until the next scheduled time, and is woken early if another
+     * thread schedules something meanwhile.
+     *
+     * @param fn Callable invoked as fn(T&&) for each expired item
+     * @return Number of items popped (at least one)
+     */
+    template<typename F>
+    std::size_t poll_wait(F&& fn) {
+        return wait_and_poll(nullptr, fn);
+    }
+
+    /**
+     * @brief Like poll_wait(), giving up at a deadline (consumer only)
+     *
+     * @param deadline Absolute timeout
+     * @param fn Callable invoked as fn(T&&) for each expired item
+     * @return Number of items popped; 0 if the deadline passed first
+     */
+    template<typename F>
+    std::size_t poll_until(Clock::time_point deadline, F&& fn) {
+        return wait_and_poll(&deadline, fn);
+    }
+
+    /**
+     * @brief Like poll_wait(), giving up after a timeout (consumer only)
+     *
+     * @param timeout Maximum time to wait
+     * @param fn Callable invoked as fn(T&&) for each expired item
+     * @return Number of items popped; 0 if the timeout elapsed first
+     */
+    template<typename Rep, typename Period, typename F>
+    std::size_t poll_for(std::chrono::duration<Rep, Period> timeout, F&& fn) {
+        return poll_until(Clock::now() + std::chrono::ceil<Clock::duration>(timeout), fn);
+    }
+
+    /**
+     * @brief Gets the time by which the wheel next needs polling (consumer only)
+     *
+     * Never later than the time at which the earliest item can be popped (its
+     * due time rounded up to a tick); may be earlier, when a coarse slot has
+     * to be cascaded. Items scheduled after the call are not covered.
+     *
+     * @return Wake-up time, empty if nothing is scheduled
+     */
+    std::optional<Clock::time_point> next_expiry() {
+        drain_inbox();
+        if (expired_head_) {
+            return time_of(current_tick_);
+        }
+        std::uint64_t tick = next_event();
+        if (tick == kNever) {
+            return std::nullopt;
+        }
+        return time_of(tick);
+    }
+
+    /**
+     * @brief Checks if no item is scheduled
+     *
+     * @note This is a snapshot and may be outdated immediately
+     */
+    bool empty() const noexcept {
+        return approximate_size() == 0;
+    }
+
+    /**
+     * @brief Gets the approximate number of scheduled items not yet popped
+     *
+     * @return Number of items (snapshot)
+     */
+    std::size_t approximate_size() const noexcept {
+        std::int64_t size = size_.sum();
+        return size > 0 ? static_cast<std::size_t>(size) : 0;
+    }
+
+    /**
+     * @brief Gets the length of one tick
+     */
+    Clock::duration resolution() const noexcept {
+        return resolution_;
+    }
+};
+
+} // namespace concurrent
@@ -0,0 +1,207 @@
+#pragma once
+
+#include "epoch.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace concurrent {
+
+/**
+ * @brief Chase-Lev work-stealing deque
+ *
+ * One owner thread pushes and pops at the bottom; any number of thieves steal
+ * from the top. The owner's push is a plain store plus a release store of
+ * bottom, and pop only needs a CAS when it races a thief for the last
+ * element. Thieves claim an element with a single CAS on top.
+ *
+ * The circular buffer doubles when full. Thieves may still be reading the old
+ * buffer, so it is retired through the Reclaimer instead of being freed.
+ *
+ * Elements are read before the claiming CAS, which is only sound for types
+ * that can be copied with a single atomic load. Store pointers or indices to
+ * larger tasks.
+ *
+ * @tparam T Element type (trivially copyable and lock-free as std::atomic<T>)
+ * @tparam Reclaimer Memory reclamation policy for outgrown buffers
+ *         (EpochDomain or HazardPointerDomain)
+ */
+template<typename T, typename Reclaimer = EpochDomain>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+    static_assert(std::atomic<T>::is_always_lock_free,
+                  "std::atomic<T> must be lock-free; store a pointer or index instead");
+
+private:
+    struct Buffer {
+        std::int64_t capacity;
+        std::int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit Buffer(std::int64_t cap)
+            : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+
+        void put(std::int64_t index, T value) noexcept {
+            slots[index & mask].store(value, std::memory_order_relaxed);
+        }
+
+        T get(std::int64_t index) const noexcept {
+            return slots[index & mask].load(std::memory_order_relaxed);
+        }
+    };
+
+    alignas(64) std::atomic<std::int64_t> top_{0};    // Thieves' end
+    alignas(64) std::atomic<std::int64_t> bottom_{0}; // Owner's end
+    alignas(64) std::atomic<Buffer*> buffer_;
+
+    static void reclaim_buffer(void* buffer) {
+        delete static_cast<Buffer*>(buffer);
+    }
+
+    // Owner only: doubles the buffer, copying the live range [top, bottom)
+    Buffer* grow(Buffer* old, std::int64_t top, std::int64_t bottom) {
+        auto* bigger = new Buffer(old->capacity * 2);
+        for (std::int64_t i = top; i < bottom; ++i) {
+            bigger->put(i, old->get(i));
+        }
+        buffer_.store(bigger, std::memory_order_release);
+        Reclaimer::retire(old, &reclaim_buffer);
+        return bigger;
+    }
+
+public:
+    /**
+     * @brief Constructs an empty deque
+     *
+     * @param capacity Initial capacity; rounded up to a power of two
+     */
+    explicit WorkStealingDeque(std::size_t capacity = 64) {
+        std::int64_t cap = 2;
+        while (cap < static_cast<std::int64_t>(capacity)) {
+            cap <<= 1;
+        }
+        buffer_.store(new Buffer(cap), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Destructor - not thread-safe
+     */
+    ~WorkStealingDeque() {
+        delete buffer_.load(std::memory_order_relaxed);
+    }
+
+    // Non-copyable, non-movable
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    /**
+     * @brief Pushes an item at the bottom (owner only)
+     *
+     * @param item The item to push
+     */
+    void push(T item) {
+        std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        if (bottom - top > buffer->capacity - 1) {
+            buffer = grow(buffer, top, bottom);
+        }
+        buffer->put(bottom, item);
+        // Publishes the element to thieves that read the new bottom
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Pops the most recently pushed item (owner only)
+     *
+     * @return std::optional<T> containing the item, empty if the deque is empty
+     */
+    std::optional<T> pop() {
+        std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        // Orders the bottom reservation against thieves' reads of bottom
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt; // Empty
+        }
+
+        T item = buffer->get(bottom);
+        if (top == bottom) {
+            // Last element: race thieves for it through top
+            bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            if (!won) {
+                return std::nullopt;
+            }
+        }
+        return item;
+    }
+
+    /**
+     * @brief Steals the oldest item from the top (any thread)
+     *
+     * @return std::optional<T> containing the item, empty if the deque was
+     *         empty or another thread claimed the item first
+     */
+    std::optional<T> steal() {
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return std::nullopt;
+        }
+
+        // The buffer may be outgrown concurrently; the guard keeps it alive
+        typename Reclaimer::Guard guard;
+        Buffer* buffer = guard.protect(0, buffer_);
+        T item = buffer->get(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+            return std::nullopt; // Lost the race to the owner or another thief
+        }
+        return item;
+    }
+
+    /**
+     * @brief Checks if the deque is empty
+     *
+     * @note This is a snapshot and may be outdated immediately
+     * @return true if the deque appears empty, false otherwise
+     */
+    bool empty() const noexcept {
+        return approximate_size() == 0;
+    }
+
+    /**
+     * @brief Gets the approximate number of elements
+     *
+     * @return Number of elements (snapshot)
+     */
+    std::size_t approximate_size() const noexcept {
+        std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+    }
+
+    /**
+     * @brief Gets the current buffer capacity (owner only)
+     *
+     * @return Number of slots before the next growth
+     */
+    std::size_t capacity() const noexcept {
+        return static_cast<std::size_t>(buffer_.load(std::memory_order_acquire)->capacity);
+    }
+};
+
+} // namespace concurrent
@@ -0,0 +1,8 @@
+// Implementation file for bounded_queue
+// Most functionality is in the header (template)
+
+#include "concurrent/bounded_queue.hpp"
+
+namespace concurrent {
+    // Template implementation is in header
+}
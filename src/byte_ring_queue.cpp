@@ -0,0 +1,8 @@
+// Implementation file for byte_ring_queue
+// Most functionality is in the header (inline)
+
+#include "concurrent/byte_ring_queue.hpp"
+
+namespace concurrent {
+    // Implementation is in header
+}
@@ -0,0 +1,8 @@
+// Implementation file for disruptor
+// Most functionality is in the header (template)
+
+#include "concurrent/disruptor.hpp"
+
+namespace concurrent {
+    // Template implementation is in header
+}
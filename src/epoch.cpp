@@ -0,0 +1,175 @@
+// Implementation file for epoch
+// Thread records, the global epoch and limbo lists live here so that every
+// translation unit shares a single reclamation domain.
+
+#include "concurrent/epoch.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace concurrent {
+
+namespace {
+
+// Low bit of a record's announced epoch marks the thread as pinned
+constexpr std::uint64_t kPinned = 1;
+
+// Number of retirements between attempts to advance the epoch
+constexpr std::size_t kCollectThreshold = 64;
+
+// An object retired while pinned at epoch e may still be referenced by
+// threads pinned at e + 1, so it is only freed once the epoch reaches e + 3.
+// Four limbo bags cover every epoch that can still hold live entries.
+constexpr std::uint64_t kGracePeriods = 3;
+constexpr std::size_t kBagCount = 4;
+
+struct Retired {
+    void* ptr;
+    EpochDomain::Deleter deleter;
+};
+
+struct LimboBag {
+    std::uint64_t epoch = 0;
+    std::vector<Retired> items;
+};
+
+struct alignas(64) ThreadRecord {
+    std::atomic<std::uint64_t> announced{0};
+    std::atomic<bool> in_use{true};
+    ThreadRecord* next = nullptr; // Immutable once published
+
+    // Owner-only state
+    unsigned nesting = 0;
+    std::size_t retired_since_collect = 0;
+    LimboBag bags[kBagCount];
+};
+
+// Records are never freed, so traversals need no protection of their own
+std::atomic<std::uint64_t> g_epoch{0};
+std::atomic<ThreadRecord*> g_records{nullptr};
+
+ThreadRecord* acquire_record() {
+    for (ThreadRecord* rec = g_records.load(std::memory_order_acquire); rec; rec = rec->next) {
+        bool expected = false;
+        if (!rec->in_use.load(std::memory_order_relaxed) &&
+            rec->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            return rec;
+        }
+    }
+
+    auto* rec = new ThreadRecord();
+    ThreadRecord* head = g_records.load(std::memory_order_relaxed);
+    do {
+        rec->next = head;
+    } while (!g_records.compare_exchange_weak(head, rec, std::memory_order_release,
+                                              std::memory_order_relaxed));
+    return rec;
+}
+
+void free_bag(LimboBag& bag) {
+    // Deleters may retire further objects, so detach the list before running them
+    std::vector<Retired> items;
+    items.swap(bag.items);
+    for (const Retired& item : items) {
+        item.deleter(item.ptr);
+    }
+    items.clear();
+    if (bag.items.empty()) {
+        bag.items.swap(items); // Keep the capacity for the next epoch
+    }
+}
+
+bool try_advance(std::uint64_t epoch) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (ThreadRecord* rec = g_records.load(std::memory_order_acquire); rec; rec = rec->next) {
+        std::uint64_t announced = rec->announced.load(std::memory_order_relaxed);
+        if ((announced & kPinned) && (announced >> 1) != epoch) {
+            return false;
+        }
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return g_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel,
+                                           std::memory_order_relaxed);
+}
+
+void collect_record(ThreadRecord* rec) {
+    std::uint64_t epoch = g_epoch.load(std::memory_order_acquire);
+    if (try_advance(epoch)) {
+        ++epoch;
+    }
+    rec->retired_since_collect = 0;
+    for (LimboBag& bag : rec->bags) {
+        if (!bag.items.empty() && bag.epoch + kGracePeriods <= epoch) {
+            free_bag(bag);
+        }
+    }
+}
+
+struct RecordHandle {
+    ThreadRecord* record = nullptr;
+
+    ~RecordHandle() {
+        if (record) {
+            collect_record(record);
+            record->announced.store(0, std::memory_order_release);
+            record->in_use.store(false, std::memory_order_release);
+        }
+    }
+};
+
+thread_local RecordHandle t_handle;
+
+ThreadRecord* local_record() {
+    if (!t_handle.record) {
+        t_handle.record = acquire_record();
+    }
+    return t_handle.record;
+}
+
+} // namespace
+
+void EpochDomain::enter() noexcept {
+    ThreadRecord* rec = local_record();
+    if (rec->nesting++ == 0) {
+        std::uint64_t epoch = g_epoch.load(std::memory_order_relaxed);
+        rec->announced.store((epoch << 1) | kPinned, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+void EpochDomain::leave() noexcept {
+    ThreadRecord* rec = t_handle.record;
+    if (--rec->nesting == 0) {
+        rec->announced.store(0, std::memory_order_release);
+    }
+}
+
+void EpochDomain::retire(void* ptr, Deleter deleter) {
+    Guard guard;
+    ThreadRecord* rec = t_handle.record;
+    std::uint64_t epoch = rec->announced.load(std::memory_order_relaxed) >> 1;
+
+    LimboBag& bag = rec->bags[epoch % kBagCount];
+    if (bag.epoch != epoch) {
+        // Anything left in this slot is at least kBagCount epochs old
+        free_bag(bag);
+        bag.epoch = epoch;
+    }
+    bag.items.push_back({ptr, deleter});
+
+    if (++rec->retired_since_collect >= kCollectThreshold) {
+        collect_record(rec);
+    }
+}
+
+void EpochDomain::collect() {
+    collect_record(local_record());
+}
+
+std::uint64_t EpochDomain::epoch() noexcept {
+    return g_epoch.load(std::memory_order_acquire);
+}
+
+} // namespace concurrent
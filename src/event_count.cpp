@@ -0,0 +1,97 @@
+// Implementation file for event_count
+// The sleeping and waking paths live here so that the platform wait
+// primitive does not leak into the headers.
+
+#include "concurrent/event_count.hpp"
+
+#if defined(__linux__)
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <algorithm>
+#include <thread>
+#endif
+
+namespace concurrent {
+
+namespace {
+
+#if defined(__linux__)
+
+static_assert(sizeof(std::atomic<EventCount::Key>) == sizeof(std::uint32_t) &&
+                  std::atomic<EventCount::Key>::is_always_lock_free,
+              "futex word must be a plain 32-bit integer");
+
+std::uint32_t* futex_word(std::atomic<EventCount::Key>& word) {
+    return reinterpret_cast<std::uint32_t*>(&word);
+}
+
+// Returns once woken, interrupted, or if the word no longer holds key
+void futex_wait(std::atomic<EventCount::Key>& word, EventCount::Key key,
+                const timespec* timeout) {
+    syscall(SYS_futex, futex_word(word), FUTEX_WAIT_PRIVATE, key, timeout, nullptr, 0);
+}
+
+void futex_wake(std::atomic<EventCount::Key>& word, int count) {
+    syscall(SYS_futex, futex_word(word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+
+#else
+
+// Upper bound on the sleep between polls of a timed wait without futexes
+constexpr auto kPollInterval = std::chrono::microseconds(50);
+
+#endif
+
+} // namespace
+
+void EventCount::wait(Key key) noexcept {
+#if defined(__linux__)
+    while (epoch_.load(std::memory_order_acquire) == key) {
+        futex_wait(epoch_, key, nullptr);
+    }
+#else
+    epoch_.wait(key, std::memory_order_acquire);
+#endif
+    waiters_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool EventCount::wait_until(Key key, std::chrono::steady_clock::time_point deadline) noexcept {
+    bool notified = true;
+    while (epoch_.load(std::memory_order_acquire) == key) {
+        auto remaining = deadline - std::chrono::steady_clock::now();
+        if (remaining <= std::chrono::steady_clock::duration::zero()) {
+            notified = false;
+            break;
+        }
+#if defined(__linux__)
+        // FUTEX_WAIT takes a relative timeout on CLOCK_MONOTONIC
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+        timespec timeout{static_cast<time_t>(ns / 1000000000), static_cast<long>(ns % 1000000000)};
+        futex_wait(epoch_, key, &timeout);
+#else
+        std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+            remaining, kPollInterval));
+#endif
+    }
+    waiters_.fetch_sub(1, std::memory_order_relaxed);
+    return notified;
+}
+
+void EventCount::wake(bool all) noexcept {
+    epoch_.fetch_add(1, std::memory_order_release);
+#if defined(__linux__)
+    futex_wake(epoch_, all ? INT_MAX : 1);
+#else
+    if (all) {
+        epoch_.notify_all();
+    } else {
+        epoch_.notify_one();
+    }
+#endif
+}
+
+} // namespace concurrent
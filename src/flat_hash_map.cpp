@@ -0,0 +1,9 @@
+// Implementation file for flat_hash_map
+// Most functionality is in the header (template)
+
+#include "concurrent/flat_hash_map.hpp"
+
+namespace concurrent {
+    // Template implementation is in header
+}
+
@@ -0,0 +1,165 @@
+// Implementation file for hazard_pointer
+// Thread records, hazard slots and retired lists live here so that every
+// translation unit shares a single reclamation domain.
+
+#include "concurrent/hazard_pointer.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace concurrent {
+
+namespace {
+
+constexpr std::size_t kSlots = HazardPointerDomain::kSlotsPerRecord;
+
+// Lower bound on the retired list size that triggers a scan
+constexpr std::size_t kMinScanThreshold = 64;
+
+struct Retired {
+    void* ptr;
+    HazardPointerDomain::Deleter deleter;
+};
+
+// Slots for guards nested deeper than one block holds; chained, never freed
+struct HazardBlock {
+    std::atomic<const void*> hazards[kSlots] = {};
+    std::atomic<HazardBlock*> next{nullptr};
+};
+
+static_assert(kSlots % HazardPointerDomain::kSlotsPerGuard == 0,
+              "a guard's slots must not straddle two blocks");
+
+struct alignas(64) ThreadRecord {
+    HazardBlock slots;
+    std::atomic<bool> in_use{true};
+    ThreadRecord* next = nullptr; // Immutable once published
+
+    // Owner-only state
+    std::size_t slots_in_use = 0;
+    std::vector<Retired> retired;
+};
+
+// Records are never freed, so scans need no protection of their own
+std::atomic<ThreadRecord*> g_records{nullptr};
+std::atomic<std::size_t> g_record_count{0};
+
+ThreadRecord* acquire_record() {
+    for (ThreadRecord* rec = g_records.load(std::memory_order_acquire); rec; rec = rec->next) {
+        bool expected = false;
+        if (!rec->in_use.load(std::memory_order_relaxed) &&
+            rec->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            return rec;
+        }
+    }
+
+    auto* rec = new ThreadRecord();
+    ThreadRecord* head = g_records.load(std::memory_order_relaxed);
+    do {
+        rec->next = head;
+    } while (!g_records.compare_exchange_weak(head, rec, std::memory_order_release,
+                                              std::memory_order_relaxed));
+    g_record_count.fetch_add(1, std::memory_order_relaxed);
+    return rec;
+}
+
+std::size_t scan_threshold() {
+    // Twice the number of slots guarantees at least half of every scan is
+    // reclaimed, which keeps the scan cost O(1) amortized per retirement
+    return std::max(kMinScanThreshold,
+                    2 * kSlots * g_record_count.load(std::memory_order_relaxed));
+}
+
+void scan(ThreadRecord* rec) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::vector<const void*> hazards;
+    for (ThreadRecord* other = g_records.load(std::memory_order_acquire); other;
+         other = other->next) {
+        for (const HazardBlock* block = &other->slots; block;
+             block = block->next.load(std::memory_order_acquire)) {
+            for (const auto& slot : block->hazards) {
+                if (const void* ptr = slot.load(std::memory_order_acquire)) {
+                    hazards.push_back(ptr);
+                }
+            }
+        }
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    // Deleters may retire further objects, so detach the list before running them
+    std::vector<Retired> retired;
+    retired.swap(rec->retired);
+    std::vector<Retired> survivors;
+    for (const Retired& item : retired) {
+        if (std::binary_search(hazards.begin(), hazards.end(),
+                               static_cast<const void*>(item.ptr))) {
+            survivors.push_back(item);
+        } else {
+            item.deleter(item.ptr);
+        }
+    }
+    rec->retired.insert(rec->retired.end(), survivors.begin(), survivors.end());
+}
+
+struct RecordHandle {
+    ThreadRecord* record = nullptr;
+
+    ~RecordHandle() {
+        if (record) {
+            scan(record);
+            record->in_use.store(false, std::memory_order_release);
+        }
+    }
+};
+
+thread_local RecordHandle t_handle;
+
+ThreadRecord* local_record() {
+    if (!t_handle.record) {
+        t_handle.record = acquire_record();
+    }
+    return t_handle.record;
+}
+
+} // namespace
+
+std::atomic<const void*>* HazardPointerDomain::acquire_slots() noexcept {
+    ThreadRecord* rec = local_record();
+    HazardBlock* block = &rec->slots;
+    for (std::size_t skip = rec->slots_in_use / kSlots; skip > 0; --skip) {
+        HazardBlock* next = block->next.load(std::memory_order_relaxed);
+        if (!next) {
+            // Nested deeper than ever before: grow. Linked before any of its
+            // slots is set, so a scan that can see the hazard sees the block
+            next = new HazardBlock();
+            block->next.store(next, std::memory_order_release);
+        }
+        block = next;
+    }
+    std::atomic<const void*>* slots = block->hazards + rec->slots_in_use % kSlots;
+    rec->slots_in_use += kSlotsPerGuard;
+    return slots;
+}
+
+void HazardPointerDomain::release_slots(std::atomic<const void*>* slots) noexcept {
+    for (std::size_t i = 0; i < kSlotsPerGuard; ++i) {
+        slots[i].store(nullptr, std::memory_order_release);
+    }
+    t_handle.record->slots_in_use -= kSlotsPerGuard;
+}
+
+void HazardPointerDomain::retire(void* ptr, Deleter deleter) {
+    ThreadRecord* rec = local_record();
+    rec->retired.push_back({ptr, deleter});
+    if (rec->retired.size() >= scan_threshold()) {
+        scan(rec);
+    }
+}
+
+void HazardPointerDomain::collect() {
+    scan(local_record());
+}
+
+} // namespace concurrent
@@ -0,0 +1,8 @@
+// Implementation file for priority_queue
+// Most functionality is in the header (template)
+
+#include "concurrent/priority_queue.hpp"
+
+namespace concurrent {
+    // Template implementation is in header
+}
@@ -0,0 +1,8 @@
+// Implementation file for segmented_queue
+// Most functionality is in the header (template)
+
+#include "concurrent/segmented_queue.hpp"
+
+namespace concurrent {
+    // Template implementation is in header
+}
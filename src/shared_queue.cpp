@@ -0,0 +1,163 @@
+// Implementation file for shared_queue
+// The mapping code lives here so that the POSIX headers do not leak into
+// the queue header.
+
+#include "concurrent/shared_queue.hpp"
+
+#include <cerrno>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CONCURRENT_HAS_POSIX_SHM 1
+#endif
+
+namespace concurrent {
+
+namespace {
+
+[[noreturn]] void throw_errno(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+} // namespace
+
+#if defined(CONCURRENT_HAS_POSIX_SHM)
+
+namespace detail {
+
+std::uint32_t current_process_id() noexcept {
+    return static_cast<std::uint32_t>(::getpid());
+}
+
+bool process_exists(std::uint32_t pid) noexcept {
+    // EPERM: alive but owned by another user
+    return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+}
+
+} // namespace detail
+
+SharedMemory::SharedMemory(int fd, std::size_t size) {
+    void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        int error = errno;
+        ::close(fd);
+        errno = error;
+        throw_errno("mmap");
+    }
+    fd_ = fd;
+    data_ = data;
+    size_ = size;
+}
+
+void SharedMemory::release() noexcept {
+    if (data_) {
+        ::munmap(data_, size_);
+        data_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    size_ = 0;
+}
+
+SharedMemory SharedMemory::create_anonymous(std::size_t size, const char* name) {
+#if defined(__linux__)
+    int fd = ::memfd_create(name, MFD_CLOEXEC);
+    if (fd < 0) {
+        throw_errno("memfd_create");
+    }
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        int error = errno;
+        ::close(fd);
+        errno = error;
+        throw_errno("ftruncate");
+    }
+    return SharedMemory(fd, size);
+#else
+    (void)size;
+    (void)name;
+    throw std::system_error(std::make_error_code(std::errc::function_not_supported),
+                            "memfd_create");
+#endif
+}
+
+SharedMemory SharedMemory::open(const std::string& name, std::size_t size) {
+    int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT, 0600);
+    if (fd < 0) {
+        throw_errno("shm_open");
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 ||
+        (static_cast<std::size_t>(info.st_size) < size &&
+         ::ftruncate(fd, static_cast<off_t>(size)) != 0)) {
+        int error = errno;
+        ::close(fd);
+        errno = error;
+        throw_errno("shm_open sizing");
+    }
+    return SharedMemory(fd, size);
+}
+
+SharedMemory SharedMemory::attach(int fd) {
+    int copy = ::fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    if (copy < 0) {
+        throw_errno("fcntl");
+    }
+    struct stat info;
+    if (::fstat(copy, &info) != 0) {
+        int error = errno;
+        ::close(copy);
+        errno = error;
+        throw_errno("fstat");
+    }
+    return SharedMemory(copy, static_cast<std::size_t>(info.st_size));
+}
+
+void SharedMemory::unlink(const std::string& name) noexcept {
+    ::shm_unlink(name.c_str());
+}
+
+#else
+
+namespace detail {
+
+std::uint32_t current_process_id() noexcept {
+    return 1;
+}
+
+bool process_exists(std::uint32_t) noexcept {
+    return true;
+}
+
+} // namespace detail
+
+SharedMemory::SharedMemory(int, std::size_t) {
+    throw std::system_error(std::make_error_code(std::errc::function_not_supported),
+                            "shared memory");
+}
+
+void SharedMemory::release() noexcept {}
+
+SharedMemory SharedMemory::create_anonymous(std::size_t size, const char*) {
+    return SharedMemory(-1, size);
+}
+
+SharedMemory SharedMemory::open(const std::string&, std::size_t size) {
+    return SharedMemory(-1, size);
+}
+
+SharedMemory SharedMemory::attach(int fd) {
+    return SharedMemory(fd, 0);
+}
+
+void SharedMemory::unlink(const std::string&) noexcept {}
+
+#endif
+
+} // namespace concurrent
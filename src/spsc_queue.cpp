@@ -0,0 +1,8 @@
+// Implementation file for spsc_queue
+// Most functionality is in the header (template)
+
+#include "concurrent/spsc_queue.hpp"
+
+namespace concurrent {
+    // Template implementation is in header
+}
@@ -0,0 +1,8 @@
+// Implementation file for timer_wheel
+// Most functionality is in the header (template)
+
+#include "concurrent/timer_wheel.hpp"
+
+namespace concurrent {
+    // Template implementation is in header
+}
@@ -0,0 +1,8 @@
+// Implementation file for work_stealing_deque
+// Most functionality is in the header (template)
+
+#include "concurrent/work_stealing_deque.hpp"
+
+namespace concurrent {
+    // Template implementation is in header
+}
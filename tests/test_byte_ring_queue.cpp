@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include "concurrent/byte_ring_queue.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace concurrent;
+
+class ByteRingQueueTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+std::string as_string(std::span<const std::byte> bytes) {
+    return std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
+// Message length for sequence number i, spread over 40..4000 bytes
+std::size_t message_size(std::uint32_t i) {
+    return 40 + (i * 2654435761u) % 3961;
+}
+
+// Byte j of message i
+std::byte message_byte(std::uint32_t i, std::size_t j) {
+    return static_cast<std::byte>((i * 31 + j) & 0xff);
+}
+
+} // namespace
+
+TEST_F(ByteRingQueueTest, ReserveCommitRead) {
+    ByteRingQueue queue(1024);
+    ASSERT_EQ(queue.capacity(), 1024u);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.read());
+
+    auto reservation = queue.reserve(5);
+    ASSERT_TRUE(reservation);
+    ASSERT_EQ(reservation.size(), 5u);
+    std::memcpy(reservation.data(), "hello", 5);
+    ASSERT_TRUE(queue.empty()); // Not visible before commit
+    reservation.commit();
+    ASSERT_TRUE(queue.try_write("world!", 6));
+    ASSERT_FALSE(queue.empty());
+
+    auto view = queue.read();
+    ASSERT_TRUE(view);
+    ASSERT_EQ(as_string(view.span()), "hello");
+    // Reading again before release sees the same message
+    ASSERT_EQ(queue.read().data(), view.data());
+    view.release();
+
+    std::string second;
+    ASSERT_TRUE(queue.try_read([&](std::span<const std::byte> bytes) { second = as_string(bytes); }));
+    ASSERT_EQ(second, "world!");
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.try_read([](std::span<const std::byte>) {}));
+}
+
+TEST_F(ByteRingQueueTest, PartialCommitAndEmptyMessages) {
+    ByteRingQueue queue(256);
+    auto reservation = queue.reserve(100);
+    ASSERT_TRUE(reservation);
+    std::memcpy(reservation.data(), "abc", 3);
+    reservation.commit(3);
+    ASSERT_TRUE(queue.try_write(nullptr, 0));
+
+    auto view = queue.read();
+    ASSERT_EQ(as_string(view.span()), "abc");
+    view.release();
+    view = queue.read();
+    ASSERT_TRUE(view);
+    ASSERT_EQ(view.size(), 0u);
+    view.release();
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(ByteRingQueueTest, FullRingRejectsReservation) {
+    ByteRingQueue queue(64);
+    ASSERT_FALSE(queue.reserve(queue.max_message_size() + 1));
+
+    // 8-byte header + 24 bytes = 32, so two records fill the ring
+    ASSERT_TRUE(queue.try_write("0123456789abcdefghijklmn", 24));
+    ASSERT_TRUE(queue.try_write("0123456789abcdefghijklmn", 24));
+    ASSERT_FALSE(queue.reserve(1));
+
+    // An abandoned reservation leaves nothing behind
+    queue.read().release();
+    {
+        auto reservation = queue.reserve(24);
+        ASSERT_TRUE(reservation);
+    }
+    queue.read().release();
+    ASSERT_TRUE(queue.empty());
+    ASSERT_TRUE(queue.reserve(queue.max_message_size()));
+}
+
+TEST_F(ByteRingQueueTest, OversizedMessagesFailCleanly) {
+    ByteRingQueue queue(64);
+    const char byte = 'x';
+    ASSERT_FALSE(queue.reserve(queue.max_message_size() + 1));
+    ASSERT_FALSE(queue.try_write(&byte, queue.max_message_size() + 1));
+    // Sizes whose rounded-up record length would wrap around
+    ASSERT_FALSE(queue.reserve(SIZE_MAX));
+    ASSERT_FALSE(queue.reserve(SIZE_MAX - 3));
+    // volatile: a constant bound makes GCC flag the (unreachable) memcpy
+    volatile std::size_t huge = SIZE_MAX;
+    ASSERT_FALSE(queue.try_write(&byte, huge));
+    ASSERT_TRUE(queue.empty());
+
+    ASSERT_TRUE(queue.try_write(&byte, 1));
+    auto view = queue.read();
+    ASSERT_TRUE(view);
+    ASSERT_EQ(as_string(view.span()), "x");
+}
+
+TEST_F(ByteRingQueueTest, MessagesStayContiguousAcrossWrap) {
+    ByteRingQueue queue(128);
+    // 40 bytes each: the third record would cross the end of the ring
+    for (char c = 'a'; c <= 'z'; ++c) {
+        std::string message(40, c);
+        ASSERT_TRUE(queue.try_write(message.data(), message.size()));
+        ASSERT_TRUE(queue.try_write(message.data(), message.size()));
+        for (int i = 0; i < 2; ++i) {
+            auto view = queue.read();
+            ASSERT_TRUE(view);
+            ASSERT_EQ(as_string(view.span()), message);
+            view.release();
+        }
+    }
+
+    // A message as large as the ring allows still fits after a skip
+    ASSERT_TRUE(queue.try_write("x", 1));
+    queue.read().release();
+    std::string big(queue.max_message_size(), 'z');
+    ASSERT_FALSE(queue.try_write(big.data(), big.size())); // Only the skip marker fits
+    ASSERT_FALSE(queue.read());                           // Consumer steps over it
+    ASSERT_TRUE(queue.try_write(big.data(), big.size()));
+    ASSERT_EQ(as_string(queue.read().span()), big);
+}
+
+TEST_F(ByteRingQueueTest, ProducerConsumerVariableSizes) {
+    ByteRingQueue queue(16 * 1024);
+    const std::uint32_t count = 50000;
+    int corrupted = 0;
+
+    std::thread consumer([&]() {
+        std::uint32_t next = 0;
+        while (next < count) {
+            auto view = queue.read();
+            if (!view) {
+                std::this_thread::yield();
+                continue;
+            }
+            bool ok = view.size() == message_size(next);
+            for (std::size_t j = 0; ok && j < view.size(); ++j) {
+                ok = view.data()[j] == message_byte(next, j);
+            }
+            if (!ok) {
+                ++corrupted;
+            }
+            view.release();
+            ++next;
+        }
+    });
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        std::size_t size = message_size(i);
+        ByteRingQueue::WriteReservation reservation;
+        while (!(reservation = queue.reserve(size))) {
+            std::this_thread::yield();
+        }
+        for (std::size_t j = 0; j < size; ++j) {
+            reservation.data()[j] = message_byte(i, j);
+        }
+        reservation.commit();
+    }
+    consumer.join();
+
+    ASSERT_EQ(corrupted, 0);
+    ASSERT_TRUE(queue.empty());
+}
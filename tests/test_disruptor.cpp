@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include "concurrent/disruptor.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace concurrent;
+
+class DisruptorTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+struct Event {
+    std::int64_t value = 0;
+    std::int64_t doubled = 0; // Written by the first pipeline stage
+};
+
+// Polls until the consumer has released `count` events, checking each one
+template<typename Consumer, typename Check>
+void consume(Consumer& consumer, std::int64_t count, Check check) {
+    while (consumer.sequence() < count - 1) {
+        if (consumer.poll(check) == 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+} // namespace
+
+TEST_F(DisruptorTest, PublishAndPoll) {
+    Disruptor<Event> ring(8);
+    ASSERT_EQ(ring.capacity(), 8u);
+    auto& consumer = ring.add_consumer();
+    ASSERT_EQ(consumer.available(), -1);
+
+    ring.publish_event([](Event& e, std::int64_t seq) { e.value = seq * 10; });
+    std::int64_t first = ring.claim(3);
+    for (std::int64_t seq = first; seq < first + 3; ++seq) {
+        ring[seq].value = seq * 10;
+    }
+    ring.publish(first, 3);
+
+    ASSERT_EQ(consumer.wait_for(0), 3);
+    std::vector<std::int64_t> seen;
+    ASSERT_EQ(consumer.poll([&](Event& e, std::int64_t) { seen.push_back(e.value); }), 4u);
+    ASSERT_EQ(seen, (std::vector<std::int64_t>{0, 10, 20, 30}));
+    ASSERT_EQ(consumer.sequence(), 3);
+    ASSERT_EQ(consumer.poll([](Event&, std::int64_t) {}), 0u);
+}
+
+TEST_F(DisruptorTest, TryClaimWaitsForSlowestConsumer) {
+    Disruptor<Event> ring(4);
+    auto& fast = ring.add_consumer();
+    auto& slow = ring.add_consumer();
+
+    auto first = ring.try_claim(4);
+    ASSERT_TRUE(first.has_value());
+    ring.publish(*first, 4);
+    ASSERT_FALSE(ring.try_claim().has_value());
+
+    fast.poll([](Event&, std::int64_t) {});
+    ASSERT_FALSE(ring.try_claim().has_value()); // slow still holds every slot
+
+    slow.poll([](Event&, std::int64_t) {});
+    auto next = ring.try_claim(4);
+    ASSERT_TRUE(next.has_value());
+    ASSERT_EQ(*next, 4);
+}
+
+TEST_F(DisruptorTest, FanOutDeliversEveryEventToEveryConsumer) {
+    constexpr std::int64_t num_events = 100000;
+    constexpr int num_consumers = 3;
+    Disruptor<Event> ring(64);
+    std::vector<Disruptor<Event>::Consumer*> consumers;
+    for (int i = 0; i < num_consumers; ++i) {
+        consumers.push_back(&ring.add_consumer());
+    }
+
+    std::vector<std::int64_t> sums(num_consumers, 0);
+    std::vector<int> order_violations(num_consumers, 0);
+    std::vector<std::thread> threads;
+    threads.reserve(num_consumers + 1);
+    for (int c = 0; c < num_consumers; ++c) {
+        threads.emplace_back([&, c]() {
+            std::int64_t expected = 0;
+            consume(*consumers[c], num_events, [&](Event& e, std::int64_t seq) {
+                if (e.value != seq || seq != expected) {
+                    ++order_violations[c];
+                }
+                ++expected;
+                sums[c] += e.value;
+            });
+        });
+    }
+    threads.emplace_back([&]() {
+        for (std::int64_t i = 0; i < num_events; ++i) {
+            ring.publish_event([i](Event& e, std::int64_t) { e.value = i; });
+        }
+    });
+
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (int c = 0; c < num_consumers; ++c) {
+        ASSERT_EQ(order_violations[c], 0);
+        ASSERT_EQ(sums[c], num_events * (num_events - 1) / 2);
+    }
+}
+
+TEST_F(DisruptorTest, DependentConsumerSeesEarlierStage) {
+    constexpr std::int64_t num_events = 50000;
+    Disruptor<Event> ring(32);
+    auto& stage_a = ring.add_consumer();
+    auto& stage_b = ring.add_consumer({&stage_a});
+    auto& stage_c = ring.add_consumer({&stage_b});
+
+    std::atomic<int> violations{0};
+    std::vector<std::thread> threads;
+    threads.reserve(4);
+    threads.emplace_back([&]() {
+        consume(stage_a, num_events, [](Event& e, std::int64_t) { e.doubled = e.value * 2; });
+    });
+    threads.emplace_back([&]() {
+        consume(stage_b, num_events, [&](Event& e, std::int64_t) {
+            if (e.doubled != e.value * 2) {
+                violations.fetch_add(1);
+            }
+        });
+    });
+    threads.emplace_back([&]() {
+        consume(stage_c, num_events, [&](Event&, std::int64_t seq) {
+            if (stage_b.sequence() < seq) {
+                violations.fetch_add(1);
+            }
+        });
+    });
+    threads.emplace_back([&]() {
+        for (std::int64_t i = 0; i < num_events; ++i) {
+            ring.publish_event([i](Event& e, std::int64_t) {
+                e.value = i;
+                e.doubled = -1;
+            });
+        }
+    });
+
+    for (auto& t : threads) {
+        t.join();
+    }
+    ASSERT_EQ(violations.load(), 0);
+}
+
+TEST_F(DisruptorTest, MultiProducerBatchClaims) {
+    constexpr int num_producers = 4;
+    constexpr std::int64_t per_producer = 20000;
+    constexpr std::int64_t total = num_producers * per_producer;
+    Disruptor<Event, ProducerType::kMulti> ring(128);
+    auto& first = ring.add_consumer();
+    auto& second = ring.add_consumer();
+
+    std::vector<std::atomic<int>> seen_first(total);
+    std::vector<std::atomic<int>> seen_second(total);
+    std::vector<std::thread> threads;
+    threads.reserve(num_producers + 2);
+    for (int p = 0; p < num_producers; ++p) {
+        threads.emplace_back([&, p]() {
+            std::int64_t next = p * per_producer;
+            std::int64_t end = next + per_producer;
+            std::size_t batch = 1;
+            while (next < end) {
+                auto count = static_cast<std::size_t>(
+                    std::min<std::int64_t>(static_cast<std::int64_t>(batch), end - next));
+                std::int64_t seq = ring.claim(count);
+                for (std::size_t i = 0; i < count; ++i) {
+                    ring[seq + static_cast<std::int64_t>(i)].value = next++;
+                }
+                ring.publish(seq, count);
+                batch = batch % 8 + 1;
+            }
+        });
+    }
+    threads.emplace_back([&]() {
+        consume(first, total, [&](Event& e, std::int64_t) { seen_first[e.value].fetch_add(1); });
+    });
+    threads.emplace_back([&]() {
+        consume(second, total, [&](Event& e, std::int64_t) { seen_second[e.value].fetch_add(1); });
+    });
+
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (std::int64_t i = 0; i < total; ++i) {
+        ASSERT_EQ(seen_first[i].load(), 1) << "value " << i;
+        ASSERT_EQ(seen_second[i].load(), 1) << "value " << i;
+    }
+}
@@ -293,18 +293,15 @@ TEST_F(EdgeCaseTest, HashMapConcurrentSameKey) {
     }
     
     // Key should exist with some value (race condition means we can't predict which)
-    // Due to concurrent updates, there might be race conditions in the hash map
-    // that could result in duplicate entries, so we're lenient about the size
     auto result = map.get(1);
     ASSERT_TRUE(result.has_value()) << "Key should exist after concurrent updates";
     
     // Value should be non-negative (basic sanity check)
     ASSERT_GE(result.value(), 0);
     
-    // Map should contain the key (size might be > 1 due to race conditions in concurrent updates)
+    // Inserts are linearizable: exactly one of them created the key
     ASSERT_TRUE(map.contains(1));
-    ASSERT_GE(map.size(), 1) << "Map should contain at least one key";
-    ASSERT_LE(map.size(), num_threads) << "Map size should not exceed number of threads (race condition tolerance)";
+    ASSERT_EQ(map.size(), 1) << "Concurrent inserts of one key must not duplicate it";
 }
 
 TEST_F(EdgeCaseTest, HashMapRapidInsertErase) {
@@ -439,7 +436,7 @@ TEST_F(EdgeCaseTest, ThreadPoolConcurrentSubmit) {
     for (int t = 0; t < num_threads; ++t) {
         threads.emplace_back([&pool, &completed, tasks_per_thread, t]() {
             for (int i = 0; i < tasks_per_thread; ++i) {
-                auto future = pool.submit([t, i]() {
+                auto future = pool.submit([t, i, tasks_per_thread]() {
                     return t * tasks_per_thread + i;
                 });
                 future.get();
@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include "concurrent/flat_hash_map.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace concurrent;
+
+namespace {
+
+// Value whose copies throw while g_copies_fail is set
+bool g_copies_fail = false;
+
+struct FragileValue {
+    int value = 0;
+
+    FragileValue() = default;
+    explicit FragileValue(int v) : value(v) {}
+    FragileValue(const FragileValue& other) : value(other.value) {
+        if (g_copies_fail) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    FragileValue& operator=(const FragileValue& other) {
+        if (g_copies_fail) {
+            throw std::runtime_error("copy failed");
+        }
+        value = other.value;
+        return *this;
+    }
+};
+
+} // namespace
+
+class FlatHashMapTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(FlatHashMapTest, InsertGetUpdateErase) {
+    FlatConcurrentHashMap<int, int> map;
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.get(1).has_value());
+
+    ASSERT_TRUE(map.insert(1, 100));
+    ASSERT_FALSE(map.insert(1, 200)); // Update
+    ASSERT_EQ(map.get(1).value(), 200);
+    ASSERT_EQ(map.size(), 1u);
+
+    ASSERT_TRUE(map.erase(1));
+    ASSERT_FALSE(map.contains(1));
+    ASSERT_FALSE(map.erase(1));
+    ASSERT_TRUE(map.empty());
+}
+
+TEST_F(FlatHashMapTest, GrowsWithStringKeys) {
+    FlatConcurrentHashMap<std::string, std::string> map(16);
+    constexpr int count = 20000;
+
+    for (int i = 0; i < count; ++i) {
+        ASSERT_TRUE(map.insert("key_" + std::to_string(i), "value_" + std::to_string(i)));
+    }
+    ASSERT_EQ(map.size(), static_cast<size_t>(count));
+    ASSERT_GE(map.capacity() * 7 / 8, static_cast<size_t>(count));
+
+    for (int i = 0; i < count; ++i) {
+        auto value = map.get("key_" + std::to_string(i));
+        ASSERT_TRUE(value.has_value());
+        ASSERT_EQ(*value, "value_" + std::to_string(i));
+    }
+    ASSERT_FALSE(map.contains("key_" + std::to_string(count)));
+}
+
+TEST_F(FlatHashMapTest, ChurnReusesTombstones) {
+    FlatConcurrentHashMap<int, int> map(100);
+    constexpr int live = 100;
+    for (int i = 0; i < live; ++i) {
+        map.insert(i, i);
+    }
+    const size_t grown = map.capacity() * 2;
+
+    // A sliding window of live keys leaves tombstones behind; they are reused
+    // or purged instead of growing the table
+    for (int i = live; i < 100000; ++i) {
+        ASSERT_TRUE(map.erase(i - live));
+        ASSERT_TRUE(map.insert(i, i));
+    }
+    ASSERT_LE(map.capacity(), grown);
+    ASSERT_EQ(map.size(), static_cast<size_t>(live));
+    for (int i = 100000 - live; i < 100000; ++i) {
+        ASSERT_EQ(map.get(i).value(), i);
+    }
+    ASSERT_FALSE(map.contains(100000 - live - 1));
+}
+
+TEST_F(FlatHashMapTest, ConcurrentWritersAndReaders) {
+    FlatConcurrentHashMap<int, int> map(16);
+    constexpr int num_writers = 4;
+    constexpr int num_readers = 2;
+    constexpr int items_per_writer = 20000;
+    std::atomic<int> writers_done{0};
+    std::atomic<int> bad_reads{0};
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_writers + num_readers);
+    for (int t = 0; t < num_writers; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < items_per_writer; ++i) {
+                int key = t * items_per_writer + i;
+                map.insert(key, key * 2);
+                if (i % 3 == 0) {
+                    map.erase(key);
+                }
+            }
+            writers_done.fetch_add(1);
+        });
+    }
+    // Readers race the writers and the resizes; a value is never torn or misplaced
+    for (int t = 0; t < num_readers; ++t) {
+        threads.emplace_back([&, t]() {
+            int key = t;
+            while (writers_done.load() < num_writers) {
+                auto value = map.get(key);
+                if (value && *value != key * 2) {
+                    bad_reads.fetch_add(1);
+                }
+                key = (key + 7919) % (num_writers * items_per_writer);
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(bad_reads.load(), 0);
+    size_t expected = 0;
+    for (int key = 0; key < num_writers * items_per_writer; ++key) {
+        auto value = map.get(key);
+        if (key % items_per_writer % 3 == 0) {
+            ASSERT_FALSE(value.has_value()) << "key " << key;
+        } else {
+            ASSERT_TRUE(value.has_value()) << "key " << key;
+            ASSERT_EQ(*value, key * 2);
+            ++expected;
+        }
+    }
+    ASSERT_EQ(map.size(), expected);
+}
+
+TEST_F(FlatHashMapTest, ConcurrentDuplicateInsertsCountOnce) {
+    FlatConcurrentHashMap<std::string, int> map(16);
+    constexpr int num_threads = 4;
+    constexpr int num_keys = 5000;
+    std::atomic<int> inserted{0};
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < num_keys; ++i) {
+                if (map.insert("key_" + std::to_string(i), t)) {
+                    inserted.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every key is inserted by exactly one thread and updated by the others
+    ASSERT_EQ(inserted.load(), num_keys);
+    ASSERT_EQ(map.size(), static_cast<size_t>(num_keys));
+    for (int i = 0; i < num_keys; ++i) {
+        auto value = map.get("key_" + std::to_string(i));
+        ASSERT_TRUE(value.has_value());
+        ASSERT_GE(*value, 0);
+        ASSERT_LT(*value, num_threads);
+    }
+}
+
+TEST_F(FlatHashMapTest, ThrowingCopiesLeaveMapUsable) {
+    FlatConcurrentHashMap<int, FragileValue> map(16);
+    const int limit = static_cast<int>(map.capacity() * 7 / 8);
+    for (int i = 0; i < limit; ++i) {
+        ASSERT_TRUE(map.insert(i, FragileValue(i)));
+    }
+    const std::size_t capacity = map.capacity();
+
+    g_copies_fail = true;
+    // Update of an existing key, then an insert that has to grow the table
+    ASSERT_THROW(map.insert(0, FragileValue(-1)), std::runtime_error);
+    ASSERT_THROW(map.insert(limit, FragileValue(limit)), std::runtime_error);
+    g_copies_fail = false;
+
+    // Neither group nor home locks were left held
+    ASSERT_EQ(map.capacity(), capacity);
+    ASSERT_EQ(map.get(0).value().value, 0);
+    ASSERT_FALSE(map.insert(0, FragileValue(100)));
+    ASSERT_EQ(map.get(0).value().value, 100);
+    ASSERT_TRUE(map.insert(limit, FragileValue(limit)));
+    ASSERT_GT(map.capacity(), capacity);
+    ASSERT_TRUE(map.erase(1));
+    for (int i = 2; i <= limit; ++i) {
+        ASSERT_EQ(map.get(i).value().value, i);
+    }
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include "concurrent/hash.hpp"
+#include <cstdint>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace concurrent;
+
+class MixHashTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(MixHashTest, StridedIntegersSpreadOverMaskedBuckets) {
+    // Identity hashing puts every multiple of 1024 in bucket 0 of a 1024-bucket table
+    constexpr std::size_t mask = 1023;
+    MixHash<std::uint64_t> hash;
+    std::set<std::size_t> buckets;
+    for (std::uint64_t i = 0; i < 4096; ++i) {
+        buckets.insert(hash(i * 1024) & mask);
+    }
+    // 4096 uniform throws into 1024 buckets leave about 2% of them empty
+    ASSERT_GT(buckets.size(), 950u);
+}
+
+TEST_F(MixHashTest, StringHashDependsOnEveryByteAndLength) {
+    MixHash<std::string> hash;
+    std::set<std::size_t> seen;
+    // Lengths 0-40 cover the short-key paths and the 16-byte rounds
+    for (std::size_t len = 0; len <= 40; ++len) {
+        std::string key(len, 'a');
+        ASSERT_TRUE(seen.insert(hash(key)).second) << "length " << len;
+        for (std::size_t i = 0; i < len; ++i) {
+            std::string flipped = key;
+            flipped[i] = 'b';
+            ASSERT_NE(hash(flipped), hash(key)) << "length " << len << ", byte " << i;
+        }
+    }
+    ASSERT_NE(hash(std::string("a")), hash(std::string("a\0", 2)));
+}
+
+TEST_F(MixHashTest, StringTypesAgree) {
+    const std::string key = "user:42";
+    ASSERT_EQ(MixHash<std::string>{}(key), MixHash<std::string_view>{}(key));
+    ASSERT_EQ(MixHash<std::string>{}(key), hash_bytes(key.data(), key.size()));
+}
+
+TEST_F(MixHashTest, PointersHashByAddress) {
+    const char text[] = "same";
+    std::string copy = text;
+    MixHash<const char*> hash;
+    ASSERT_EQ(hash(text), hash(text));
+    ASSERT_NE(hash(text), hash(copy.c_str()));
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include "concurrent/lockfree_hashmap.hpp"
+#include "concurrent/hazard_pointer.hpp"
+#include <atomic>
+#include <optional>
 #include <thread>
 #include <vector>
 #include <string>
@@ -147,3 +150,321 @@ TEST_F(LockFreeHashMapTest, EmptyAndSize) {
     ASSERT_EQ(map.size(), 0);
 }
 
+TEST_F(LockFreeHashMapTest, StridedKeysWithCustomHasher) {
+    // Identity-hashed multiples of 4096 all share bucket 0; lookups stay
+    // correct, just slow, so the default MixHash matters only for speed
+    LockFreeHashMap<long, long, std::hash<long>> identity(16);
+    LockFreeHashMap<long, long> mixed(16);
+    constexpr long count = 2000;
+    for (long i = 0; i < count; ++i) {
+        ASSERT_TRUE(identity.insert(i * 4096, i));
+        ASSERT_TRUE(mixed.insert(i * 4096, i));
+    }
+    for (long i = 0; i < count; ++i) {
+        ASSERT_EQ(identity.get(i * 4096).value(), i);
+        ASSERT_EQ(mixed.get(i * 4096).value(), i);
+    }
+    ASSERT_FALSE(mixed.contains(4096 * count));
+    ASSERT_EQ(identity.size(), static_cast<size_t>(count));
+    ASSERT_EQ(mixed.size(), static_cast<size_t>(count));
+}
+
+TEST_F(LockFreeHashMapTest, GrowsWithSize) {
+    LockFreeHashMap<int, int> map(4);
+    ASSERT_EQ(map.bucket_count(), 4u);
+    constexpr int count = 100000;
+
+    for (int i = 0; i < count; ++i) {
+        map.insert(i, i);
+    }
+    // The load factor stays bounded instead of the buckets growing long
+    ASSERT_GE(static_cast<double>(map.bucket_count()) * 0.75, static_cast<double>(count) / 2);
+    for (int i = 0; i < count; ++i) {
+        auto result = map.get(i);
+        ASSERT_TRUE(result.has_value());
+        ASSERT_EQ(result.value(), i);
+    }
+
+    for (int i = 0; i < count; i += 2) {
+        ASSERT_TRUE(map.erase(i));
+    }
+    for (int i = 0; i < count; ++i) {
+        ASSERT_EQ(map.contains(i), i % 2 == 1);
+    }
+    ASSERT_EQ(map.size(), static_cast<size_t>(count / 2));
+}
+
+namespace {
+
+template<typename Reclaimer>
+void run_insert_erase_while_growing() {
+    LockFreeHashMap<int, int, std::hash<int>, Reclaimer> map(1);
+    constexpr int num_threads = 4;
+    constexpr int items_per_thread = 20000;
+
+    // Each thread inserts its range and erases every third key while other
+    // threads keep doubling the table and splitting buckets underneath it
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&map, t]() {
+            for (int i = 0; i < items_per_thread; ++i) {
+                int key = t * items_per_thread + i;
+                map.insert(key, key * 2);
+                if (i % 3 == 0) {
+                    map.erase(key);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    size_t expected = 0;
+    for (int key = 0; key < num_threads * items_per_thread; ++key) {
+        auto result = map.get(key);
+        if (key % items_per_thread % 3 == 0) {
+            ASSERT_FALSE(result.has_value()) << "key " << key;
+        } else {
+            ASSERT_TRUE(result.has_value()) << "key " << key;
+            ASSERT_EQ(result.value(), key * 2);
+            ++expected;
+        }
+    }
+    ASSERT_EQ(map.size(), expected);
+}
+
+// Readers copy a large value while writers keep replacing it; every copy
+// must be one complete value that was written, never freed memory
+template<typename Reclaimer>
+void run_update_while_reading() {
+    LockFreeHashMap<int, std::string, std::hash<int>, Reclaimer> map;
+    constexpr int num_keys = 16;
+    constexpr int updates = 20000;
+    auto make = [](int key, int round) {
+        return std::string(64, static_cast<char>('a' + (key + round) % 26));
+    };
+    for (int key = 0; key < num_keys; ++key) {
+        map.insert(key, make(key, 0));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<int> bad_reads{0};
+    std::vector<std::thread> threads;
+    threads.reserve(3);
+    threads.emplace_back([&]() {
+        for (int round = 1; round <= updates; ++round) {
+            map.insert(round % num_keys, make(round % num_keys, round));
+        }
+        done.store(true);
+    });
+    for (int t = 0; t < 2; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; !done.load(); ++i) {
+                auto value = map.get(i % num_keys);
+                if (!value || value->size() != 64 ||
+                    value->find_first_not_of(value->front()) != std::string::npos) {
+                    bad_reads.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(bad_reads.load(), 0);
+    ASSERT_EQ(map.size(), static_cast<size_t>(num_keys));
+}
+
+// Threads count word occurrences with compute: one map with inline int
+// counters and one whose string values grow by one character per update
+template<typename Reclaimer>
+void run_concurrent_compute() {
+    LockFreeHashMap<int, int, std::hash<int>, Reclaimer> counts;
+    LockFreeHashMap<int, std::string, std::hash<int>, Reclaimer> tallies;
+    constexpr int num_threads = 4;
+    constexpr int ops_per_thread = 5000;
+    constexpr int num_keys = 8;
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < ops_per_thread; ++i) {
+                counts.compute(i % num_keys, [](const std::optional<int>& c) {
+                    return c.value_or(0) + 1;
+                });
+                tallies.compute(i % num_keys, [](const std::optional<std::string>& s) {
+                    return s.value_or("") + "x";
+                });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // No increment is lost and no key is inserted twice
+    const int expected = num_threads * ops_per_thread / num_keys;
+    ASSERT_EQ(counts.size(), static_cast<size_t>(num_keys));
+    ASSERT_EQ(tallies.size(), static_cast<size_t>(num_keys));
+    for (int key = 0; key < num_keys; ++key) {
+        ASSERT_EQ(counts.get(key).value(), expected);
+        ASSERT_EQ(tallies.get(key).value().size(), static_cast<size_t>(expected));
+    }
+}
+
+// Counters are incremented with compute and fetch_update while another
+// thread erases them; no update may land on an erased node, so the map stays
+// consistent and, once the eraser stops, each compute is what get() returns
+template<typename Reclaimer, typename V>
+void run_compute_while_erasing() {
+    LockFreeHashMap<int, V, std::hash<int>, Reclaimer> map(1);
+    constexpr int num_threads = 3;
+    constexpr int ops_per_thread = 20000;
+    constexpr int num_keys = 4;
+    std::atomic<bool> stop{false};
+    std::atomic<int> erased{0};
+    auto increment = [](const std::optional<V>& v) { return V(v.value_or(V(0)) + 1); };
+
+    std::thread eraser([&]() {
+        while (!stop.load()) {
+            for (int key = 0; key < num_keys; ++key) {
+                if (map.erase(key)) {
+                    erased.fetch_add(1);
+                }
+            }
+        }
+    });
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&]() {
+            // Keep going until the eraser has actually raced the updates
+            for (int i = 0; i < ops_per_thread || erased.load() < 100; ++i) {
+                map.compute(i % num_keys, increment);
+                map.fetch_update(i % num_keys, [](const V& v) { return V(v + 1); });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    stop.store(true);
+    eraser.join();
+
+    // The map is consistent: no duplicates, and size counts live keys only
+    size_t live = 0;
+    for (int key = 0; key < num_keys; ++key) {
+        live += map.contains(key) ? 1 : 0;
+        ASSERT_EQ(map.get(key).has_value(), map.contains(key));
+    }
+    ASSERT_EQ(map.size(), live);
+
+    // Without a racing erase, a compute is visible to the next reader
+    for (int key = 0; key < num_keys; ++key) {
+        V stored = map.compute(key, increment);
+        ASSERT_EQ(map.get(key).value(), stored);
+        ASSERT_TRUE(map.erase(key));
+        ASSERT_FALSE(map.fetch_update(key, [](const V& v) { return V(v + 1); }).has_value());
+        ASSERT_EQ(map.compute(key, increment), V(1));
+    }
+}
+
+} // namespace
+
+TEST_F(LockFreeHashMapTest, TryEmplaceKeepsExisting) {
+    LockFreeHashMap<int, std::string> map;
+    ASSERT_TRUE(map.try_emplace(1, 3, 'a')); // std::string(3, 'a')
+    ASSERT_FALSE(map.try_emplace(1, "other"));
+    ASSERT_EQ(map.get(1).value(), "aaa");
+
+    std::string value = "moved";
+    ASSERT_FALSE(map.insert_or_assign(1, std::move(value)));
+    ASSERT_EQ(map.get(1).value(), "moved");
+    ASSERT_TRUE(map.insert_or_assign(2, std::string("two")));
+    ASSERT_EQ(map.size(), 2u);
+}
+
+TEST_F(LockFreeHashMapTest, FetchUpdateOnlyExistingKeys) {
+    LockFreeHashMap<int, int> map;
+    ASSERT_FALSE(map.fetch_update(1, [](int v) { return v + 1; }).has_value());
+    ASSERT_FALSE(map.contains(1));
+
+    map.insert(1, 41);
+    ASSERT_EQ(map.fetch_update(1, [](int v) { return v + 1; }).value(), 41);
+    ASSERT_EQ(map.get(1).value(), 42);
+    ASSERT_EQ(map.compute(1, [](const std::optional<int>& v) { return v.value_or(0) * 2; }), 84);
+    ASSERT_EQ(map.compute(2, [](const std::optional<int>& v) { return v ? 0 : 7; }), 7);
+}
+
+TEST_F(LockFreeHashMapTest, ConcurrentTryEmplaceInsertsOnce) {
+    LockFreeHashMap<int, int> map(1);
+    constexpr int num_threads = 4;
+    constexpr int num_keys = 20000;
+    std::atomic<int> inserted{0};
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int key = 0; key < num_keys; ++key) {
+                if (map.try_emplace(key, t)) {
+                    inserted.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(inserted.load(), num_keys);
+    ASSERT_EQ(map.size(), static_cast<size_t>(num_keys));
+}
+
+TEST_F(LockFreeHashMapTest, ConcurrentCompute) {
+    run_concurrent_compute<EpochDomain>();
+}
+
+TEST_F(LockFreeHashMapTest, ConcurrentComputeHazardPointers) {
+    run_concurrent_compute<HazardPointerDomain>();
+}
+
+TEST_F(LockFreeHashMapTest, ComputeRacingErase) {
+    run_compute_while_erasing<EpochDomain, int>();
+    run_compute_while_erasing<EpochDomain, long>(); // Out of line
+}
+
+TEST_F(LockFreeHashMapTest, ComputeRacingEraseHazardPointers) {
+    run_compute_while_erasing<HazardPointerDomain, int>();
+    run_compute_while_erasing<HazardPointerDomain, long>();
+}
+
+TEST_F(LockFreeHashMapTest, InlineValuesUpdateInPlace) {
+    LockFreeHashMap<int, int> map;
+    ASSERT_TRUE(map.insert(1, 10));
+    for (int v = 0; v < 1000; ++v) {
+        ASSERT_FALSE(map.insert(1, v));
+    }
+    ASSERT_EQ(map.get(1).value(), 999);
+    ASSERT_EQ(map.size(), 1u);
+}
+
+TEST_F(LockFreeHashMapTest, UpdateWhileReading) {
+    run_update_while_reading<EpochDomain>();
+}
+
+TEST_F(LockFreeHashMapTest, UpdateWhileReadingHazardPointers) {
+    run_update_while_reading<HazardPointerDomain>();
+}
+
+TEST_F(LockFreeHashMapTest, ConcurrentInsertEraseWhileGrowing) {
+    run_insert_erase_while_growing<EpochDomain>();
+}
+
+TEST_F(LockFreeHashMapTest, ConcurrentInsertEraseWhileGrowingHazardPointers) {
+    run_insert_erase_while_growing<HazardPointerDomain>();
+}
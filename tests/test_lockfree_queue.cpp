@@ -1,8 +1,15 @@
 #include <gtest/gtest.h>
+#include "concurrent/bounded_queue.hpp"
+#include "concurrent/hazard_pointer.hpp"
 #include "concurrent/lockfree_queue.hpp"
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <thread>
 #include <vector>
 #include <atomic>
+#include <chrono>
 
 using namespace concurrent;
 
@@ -134,3 +141,913 @@ TEST_F(LockFreeQueueTest, MoveSemantics) {
     ASSERT_EQ(*result.value(), 42);
 }
 
+
+namespace {
+
+struct Counted {
+    static inline std::atomic<int> live{0};
+    int value;
+
+    explicit Counted(int v) : value(v) {
+        live.fetch_add(1);
+    }
+    Counted(Counted&& other) noexcept : value(other.value) {
+        live.fetch_add(1);
+    }
+    Counted(const Counted&) = delete;
+    ~Counted() {
+        live.fetch_sub(1);
+    }
+};
+
+struct alignas(64) OverAligned {
+    int value;
+};
+
+} // namespace
+
+TEST_F(LockFreeQueueTest, InlinePayloadLifetime) {
+    Counted::live.store(0);
+    {
+        LockFreeQueue<Counted> queue;
+        for (int i = 0; i < 10; ++i) {
+            queue.enqueue(Counted(i));
+        }
+        ASSERT_EQ(Counted::live.load(), 10);
+
+        for (int i = 0; i < 4; ++i) {
+            auto result = queue.dequeue();
+            ASSERT_TRUE(result.has_value());
+            ASSERT_EQ(result->value, i);
+        }
+        ASSERT_EQ(Counted::live.load(), 6);
+    }
+    // Items still queued are destroyed with the queue
+    ASSERT_EQ(Counted::live.load(), 0);
+}
+
+TEST_F(LockFreeQueueTest, OverAlignedPayload) {
+    LockFreeQueue<OverAligned> queue;
+
+    for (int i = 0; i < 100; ++i) {
+        queue.enqueue(OverAligned{i});
+    }
+    for (int i = 0; i < 100; ++i) {
+        auto result = queue.dequeue();
+        ASSERT_TRUE(result.has_value());
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(&result.value()) % alignof(OverAligned), 0u);
+        ASSERT_EQ(result->value, i);
+    }
+}
+
+TEST_F(LockFreeQueueTest, ApproximateSizeTracksOperations) {
+    LockFreeQueue<int> queue;
+    ASSERT_EQ(queue.approximate_size(), 0u);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&queue]() {
+            for (int i = 0; i < 1000; ++i) {
+                queue.enqueue(i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(queue.approximate_size(), 4000u);
+
+    std::vector<int> input(100);
+    queue.enqueue_bulk(input.begin(), input.end());
+    std::vector<int> output;
+    queue.try_dequeue_bulk(std::back_inserter(output), 250);
+    queue.dequeue();
+    ASSERT_EQ(queue.approximate_size(), 3849u);
+}
+
+TEST_F(LockFreeQueueTest, BulkEnqueueDequeue) {
+    LockFreeQueue<int> queue;
+    std::vector<int> input{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    ASSERT_EQ(queue.enqueue_bulk(input.begin(), input.begin()), 0u);
+    ASSERT_EQ(queue.enqueue_bulk(input.begin(), input.end()), input.size());
+    queue.enqueue(10);
+
+    std::vector<int> output;
+    ASSERT_EQ(queue.try_dequeue_bulk(std::back_inserter(output), 4), 4u);
+    ASSERT_EQ(queue.dequeue().value(), 4);
+    ASSERT_EQ(queue.try_dequeue_bulk(std::back_inserter(output), 100), 6u);
+    ASSERT_EQ(queue.try_dequeue_bulk(std::back_inserter(output), 100), 0u);
+
+    ASSERT_EQ(output, (std::vector<int>{0, 1, 2, 3, 5, 6, 7, 8, 9, 10}));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(LockFreeQueueTest, BulkMoveOnlyPayload) {
+    LockFreeQueue<std::unique_ptr<int>> queue;
+    std::vector<std::unique_ptr<int>> input;
+    for (int i = 0; i < 5; ++i) {
+        input.push_back(std::make_unique<int>(i));
+    }
+
+    queue.enqueue_bulk(std::make_move_iterator(input.begin()),
+                       std::make_move_iterator(input.end()));
+
+    std::vector<std::unique_ptr<int>> output;
+    ASSERT_EQ(queue.try_dequeue_bulk(std::back_inserter(output), 5), 5u);
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(*output[i], i);
+    }
+}
+
+namespace {
+
+// Batched producers and consumers; each producer's items must stay in order
+template<typename Reclaimer>
+void run_bulk_producer_consumer() {
+    constexpr int num_producers = 4;
+    constexpr int num_consumers = 4;
+    constexpr int items_per_producer = 20000;
+    constexpr int batch = 32;
+    LockFreeQueue<int, Reclaimer> queue;
+
+    std::atomic<int> consumed{0};
+    std::atomic<long long> sum{0};
+    std::atomic<int> order_violations{0};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_producers; ++t) {
+        threads.emplace_back([&queue, t]() {
+            std::vector<int> buffer(batch);
+            for (int base = 0; base < items_per_producer; base += batch) {
+                for (int i = 0; i < batch; ++i) {
+                    buffer[i] = t * items_per_producer + base + i;
+                }
+                queue.enqueue_bulk(buffer.begin(), buffer.end());
+            }
+        });
+    }
+
+    for (int t = 0; t < num_consumers; ++t) {
+        threads.emplace_back([&]() {
+            std::vector<int> last(num_producers, -1);
+            std::vector<int> items;
+            while (consumed.load() < num_producers * items_per_producer) {
+                items.clear();
+                std::size_t n = queue.try_dequeue_bulk(std::back_inserter(items), 48);
+                if (n == 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                for (int item : items) {
+                    int producer = item / items_per_producer;
+                    if (item <= last[producer]) {
+                        order_violations.fetch_add(1);
+                    }
+                    last[producer] = item;
+                    sum.fetch_add(item);
+                }
+                consumed.fetch_add(static_cast<int>(n));
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const long long n = num_producers * items_per_producer;
+    ASSERT_EQ(consumed.load(), n);
+    ASSERT_EQ(sum.load(), n * (n - 1) / 2);
+    ASSERT_EQ(order_violations.load(), 0);
+    ASSERT_TRUE(queue.empty());
+}
+
+} // namespace
+
+TEST_F(LockFreeQueueTest, BulkProducerConsumer) {
+    run_bulk_producer_consumer<EpochDomain>();
+}
+
+TEST_F(LockFreeQueueTest, BulkProducerConsumerHazardPointers) {
+    run_bulk_producer_consumer<HazardPointerDomain>();
+}
+
+TEST_F(LockFreeQueueTest, DequeueForTimesOutWhenEmpty) {
+    LockFreeQueue<int> queue;
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = queue.dequeue_for(std::chrono::milliseconds(20));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_FALSE(result.has_value());
+    ASSERT_GE(elapsed, std::chrono::milliseconds(20));
+
+    queue.enqueue(5);
+    ASSERT_EQ(queue.dequeue_for(std::chrono::seconds(1)).value(), 5);
+    ASSERT_FALSE(queue.dequeue_until(std::chrono::system_clock::now()).has_value());
+}
+
+TEST_F(LockFreeQueueTest, DequeueWaitWakesOnEnqueue) {
+    LockFreeQueue<int> queue;
+    std::atomic<bool> got{false};
+
+    std::thread consumer([&]() {
+        ASSERT_EQ(queue.dequeue_wait(), 42);
+        got.store(true);
+    });
+
+    // Give the consumer time to park
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_FALSE(got.load());
+
+    queue.enqueue(42);
+    consumer.join();
+    ASSERT_TRUE(got.load());
+}
+
+TEST_F(LockFreeQueueTest, BlockingConsumersReceiveEverything) {
+    constexpr int num_producers = 4;
+    constexpr int num_consumers = 4;
+    constexpr int items_per_producer = 10000;
+    LockFreeQueue<int> queue;
+
+    std::atomic<long long> sum{0};
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_consumers; ++t) {
+        threads.emplace_back([&]() {
+            // -1 is the per-consumer stop sentinel
+            for (int item = queue.dequeue_wait(); item != -1; item = queue.dequeue_wait()) {
+                sum.fetch_add(item);
+                consumed.fetch_add(1);
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < num_producers; ++t) {
+        producers.emplace_back([&queue, t]() {
+            for (int i = 0; i < items_per_producer; ++i) {
+                queue.enqueue(t * items_per_producer + i);
+                if (i % 1000 == 0) {
+                    // Let consumers drain and park between bursts
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+            }
+        });
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    for (int t = 0; t < num_consumers; ++t) {
+        queue.enqueue(-1);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const long long n = num_producers * items_per_producer;
+    ASSERT_EQ(consumed.load(), n);
+    ASSERT_EQ(sum.load(), n * (n - 1) / 2);
+}
+
+TEST_F(LockFreeQueueTest, ProducerTokensKeepPerProducerOrder) {
+    constexpr int num_producers = 8;
+    constexpr int num_consumers = 4;
+    constexpr int items_per_producer = 10000;
+    LockFreeQueue<int> queue;
+
+    std::atomic<int> consumed{0};
+    std::atomic<long long> sum{0};
+    std::atomic<int> order_violations{0};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_producers; ++t) {
+        threads.emplace_back([&queue, t]() {
+            auto token = queue.make_producer_token();
+            for (int i = 0; i < items_per_producer; ++i) {
+                // Mix token and untokened enqueues; each path keeps its own order
+                if (t % 2 == 0) {
+                    queue.enqueue(token, t * items_per_producer + i);
+                } else {
+                    queue.enqueue(t * items_per_producer + i);
+                }
+            }
+        });
+    }
+
+    for (int t = 0; t < num_consumers; ++t) {
+        threads.emplace_back([&]() {
+            std::vector<int> last(num_producers, -1);
+            while (consumed.load() < num_producers * items_per_producer) {
+                if (auto item = queue.dequeue()) {
+                    int producer = *item / items_per_producer;
+                    if (*item <= last[producer]) {
+                        order_violations.fetch_add(1);
+                    }
+                    last[producer] = *item;
+                    sum.fetch_add(*item);
+                    consumed.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const long long n = num_producers * items_per_producer;
+    ASSERT_EQ(sum.load(), n * (n - 1) / 2);
+    ASSERT_EQ(order_violations.load(), 0);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.approximate_size(), 0u);
+}
+
+TEST_F(LockFreeQueueTest, ProducerTokensReuseAndShareLanes) {
+    LockFreeQueue<int> queue;
+
+    {
+        // More tokens than dedicated lanes: the surplus shares lanes
+        std::vector<LockFreeQueue<int>::ProducerToken> tokens;
+        for (int i = 0; i < 100; ++i) {
+            tokens.push_back(queue.make_producer_token());
+        }
+        for (int i = 0; i < 100; ++i) {
+            queue.enqueue(tokens[i], i);
+        }
+    }
+
+    // Released lanes are handed out again and their items stay reachable
+    auto token = queue.make_producer_token();
+    queue.enqueue(token, 100);
+    std::vector<int> bulk{101, 102, 103};
+    queue.enqueue_bulk(token, bulk.begin(), bulk.end());
+
+    std::vector<int> output;
+    while (output.size() < 104) {
+        if (queue.try_dequeue_bulk(std::back_inserter(output), 7) == 0) {
+            break;
+        }
+    }
+    ASSERT_EQ(output.size(), 104u);
+    long long total = 0;
+    for (int value : output) {
+        total += value;
+    }
+    ASSERT_EQ(total, 103 * 104 / 2);
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(LockFreeQueueTest, DequeueWaitWakesOnTokenEnqueue) {
+    LockFreeQueue<int> queue;
+    auto token = queue.make_producer_token();
+
+    std::thread consumer([&]() {
+        ASSERT_EQ(queue.dequeue_wait(), 7);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.enqueue(token, 7);
+    consumer.join();
+}
+
+TEST_F(LockFreeQueueTest, PeekLeavesQueueUnchanged) {
+    LockFreeQueue<int> queue;
+    ASSERT_FALSE(queue.peek().has_value());
+
+    queue.enqueue(1);
+    queue.enqueue(2);
+    ASSERT_EQ(queue.peek(), 1);
+    ASSERT_EQ(queue.peek(), 1);
+    ASSERT_EQ(queue.approximate_size(), 2u);
+
+    ASSERT_EQ(queue.dequeue(), 1);
+    ASSERT_EQ(queue.peek(), 2);
+    ASSERT_EQ(queue.dequeue(), 2);
+    ASSERT_FALSE(queue.peek().has_value());
+}
+
+TEST_F(LockFreeQueueTest, SnapshotVisitsInOrder) {
+    LockFreeQueue<int> queue;
+    for (int i = 0; i < 10; ++i) {
+        queue.enqueue(i);
+    }
+
+    std::vector<int> seen;
+    ASSERT_EQ(queue.for_each_snapshot(100, [&seen](const int& v) { seen.push_back(v); }), 10u);
+    ASSERT_EQ(seen, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    seen.clear();
+    ASSERT_EQ(queue.for_each_snapshot(3, [&seen](const int& v) { seen.push_back(v); }), 3u);
+    ASSERT_EQ(seen, (std::vector<int>{0, 1, 2}));
+
+    // Nothing was removed
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_EQ(queue.dequeue(), i);
+    }
+    ASSERT_EQ(queue.for_each_snapshot(100, [](const int&) {}), 0u);
+}
+
+TEST_F(LockFreeQueueTest, SnapshotCoversTokenLanes) {
+    LockFreeQueue<int> queue;
+    auto token = queue.make_producer_token();
+    queue.enqueue(1);
+    queue.enqueue(token, 2);
+
+    long long total = 0;
+    ASSERT_EQ(queue.for_each_snapshot(100, [&total](const int& v) { total += v; }), 2u);
+    ASSERT_EQ(total, 3);
+}
+
+TEST_F(LockFreeQueueTest, SnapshotCallbackMayDequeueVisitedElement) {
+    LockFreeQueue<std::string> queue;
+    const std::string first(40, 'a'); // Heap-allocated, so use-after-free shows up
+    queue.enqueue(first);
+    queue.enqueue("second");
+
+    std::vector<std::string> seen;
+    queue.for_each_snapshot(1, [&](const std::string& v) {
+        // The consumer gets a copy and the element stays intact until fn returns
+        ASSERT_EQ(queue.dequeue(), first);
+        seen.push_back(v);
+    });
+    ASSERT_EQ(seen, std::vector<std::string>{first});
+    ASSERT_EQ(queue.peek(), "second");
+}
+
+TEST_F(LockFreeQueueTest, SlowSnapshotDoesNotStallConsumers) {
+    LockFreeQueue<int> queue;
+    for (int i = 0; i < 100; ++i) {
+        queue.enqueue(i);
+    }
+    std::atomic<bool> visiting{false};
+    std::atomic<bool> drained{false};
+
+    std::thread reader([&]() {
+        queue.for_each_snapshot(1, [&](const int& v) {
+            visiting.store(true);
+            // Held until the consumer has dequeued every element, this one included
+            while (!drained.load()) {
+                std::this_thread::yield();
+            }
+            ASSERT_EQ(v, 0);
+        });
+    });
+    while (!visiting.load()) {
+        std::this_thread::yield();
+    }
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(queue.dequeue(), i);
+    }
+    drained.store(true);
+    reader.join();
+    ASSERT_TRUE(queue.empty());
+}
+
+namespace {
+
+// Readers snapshot continuously while producers and consumers drain the
+// queue; every visited element must still be intact
+template<typename Reclaimer>
+void run_snapshot_under_contention() {
+    LockFreeQueue<std::string, Reclaimer> queue;
+    const int num_producers = 2;
+    const int items_per_producer = 5000;
+    const std::string prefix(32, 'x'); // Heap-allocated, so use-after-free shows up
+    std::atomic<int> consumed{0};
+    std::atomic<bool> done{false};
+    std::atomic<int> corrupt{0};
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_producers + 2);
+    for (int p = 0; p < num_producers; ++p) {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < items_per_producer; ++i) {
+                queue.enqueue(prefix + std::to_string(p * items_per_producer + i));
+            }
+        });
+    }
+    threads.emplace_back([&]() {
+        while (consumed.load() < num_producers * items_per_producer) {
+            if (queue.dequeue()) {
+                consumed.fetch_add(1);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        done.store(true);
+    });
+    threads.emplace_back([&]() {
+        while (!done.load()) {
+            queue.for_each_snapshot(64, [&](const std::string& v) {
+                if (v.compare(0, prefix.size(), prefix) != 0) {
+                    corrupt.fetch_add(1);
+                }
+            });
+            std::this_thread::yield();
+        }
+    });
+
+    for (auto& t : threads) {
+        t.join();
+    }
+    ASSERT_EQ(corrupt.load(), 0);
+    ASSERT_TRUE(queue.empty());
+}
+
+} // namespace
+
+TEST_F(LockFreeQueueTest, SnapshotUnderContention) {
+    run_snapshot_under_contention<EpochDomain>();
+}
+
+TEST_F(LockFreeQueueTest, SnapshotUnderContentionHazardPointers) {
+    run_snapshot_under_contention<HazardPointerDomain>();
+}
+
+TEST_F(LockFreeQueueTest, CloseRejectsEnqueuesAndDrains) {
+    LockFreeQueue<int> queue;
+    auto token = queue.make_producer_token();
+    queue.enqueue(1);
+    queue.enqueue(token, 2);
+    ASSERT_FALSE(queue.is_closed());
+
+    queue.close();
+    ASSERT_TRUE(queue.is_closed());
+    ASSERT_FALSE(queue.enqueue(3));
+    ASSERT_FALSE(queue.enqueue(token, 4));
+    std::vector<int> batch{5, 6};
+    ASSERT_EQ(queue.enqueue_bulk(batch.begin(), batch.end()), 0u);
+
+    // Accepted items are still delivered before the closed status
+    int value = 0;
+    long long total = 0;
+    ASSERT_EQ(queue.try_dequeue(value), DequeueStatus::kOk);
+    total += value;
+    ASSERT_EQ(queue.dequeue_wait(value), DequeueStatus::kOk);
+    total += value;
+    ASSERT_EQ(total, 3);
+
+    ASSERT_EQ(queue.try_dequeue(value), DequeueStatus::kClosed);
+    ASSERT_EQ(queue.dequeue_wait(value), DequeueStatus::kClosed);
+    ASSERT_EQ(queue.dequeue_for(value, std::chrono::seconds(10)), DequeueStatus::kClosed);
+    ASSERT_FALSE(queue.dequeue_for(std::chrono::seconds(10)).has_value());
+    ASSERT_THROW(queue.dequeue_wait(), std::runtime_error);
+    ASSERT_EQ(queue.approximate_size(), 0u);
+}
+
+TEST_F(LockFreeQueueTest, TryDequeueReportsEmptyBeforeClose) {
+    LockFreeQueue<int> queue;
+    int value = 0;
+    ASSERT_EQ(queue.try_dequeue(value), DequeueStatus::kEmpty);
+    ASSERT_EQ(queue.dequeue_for(value, std::chrono::milliseconds(5)), DequeueStatus::kTimeout);
+}
+
+TEST_F(LockFreeQueueTest, CloseWakesParkedConsumers) {
+    LockFreeQueue<int> queue;
+    const int num_consumers = 3;
+    std::atomic<int> closed_seen{0};
+
+    std::vector<std::thread> consumers;
+    consumers.reserve(num_consumers);
+    for (int i = 0; i < num_consumers; ++i) {
+        consumers.emplace_back([&]() {
+            int value = 0;
+            if (queue.dequeue_wait(value) == DequeueStatus::kClosed) {
+                closed_seen.fetch_add(1);
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.close();
+    for (auto& t : consumers) {
+        t.join();
+    }
+    ASSERT_EQ(closed_seen.load(), num_consumers);
+}
+
+TEST_F(LockFreeQueueTest, CloseWhileProducingLosesNothing) {
+    LockFreeQueue<int> queue;
+    const int num_producers = 3;
+    const int num_consumers = 2;
+    std::atomic<long long> accepted_sum{0};
+    std::atomic<long long> consumed_sum{0};
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_producers + num_consumers);
+    for (int p = 0; p < num_producers; ++p) {
+        threads.emplace_back([&, p]() {
+            auto token = queue.make_producer_token();
+            for (int i = 1;; ++i) {
+                int value = p * 1000000 + i;
+                bool ok = p == 0 ? queue.enqueue(value) : queue.enqueue(token, value);
+                if (!ok) {
+                    break;
+                }
+                accepted_sum.fetch_add(value);
+                if (i % 64 == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < num_consumers; ++c) {
+        threads.emplace_back([&]() {
+            int value = 0;
+            while (queue.dequeue_wait(value) == DequeueStatus::kOk) {
+                consumed_sum.fetch_add(value);
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.close();
+    for (auto& t : threads) {
+        t.join();
+    }
+    // Every accepted item reached a consumer before it saw kClosed
+    ASSERT_EQ(consumed_sum.load(), accepted_sum.load());
+    ASSERT_TRUE(queue.empty());
+}
+
+namespace {
+
+struct Emplaced {
+    static inline std::atomic<int> moves{0};
+    int id;
+    std::string name;
+
+    Emplaced(int i, std::string n) : id(i), name(std::move(n)) {}
+    Emplaced(Emplaced&& other) noexcept : id(other.id), name(std::move(other.name)) {
+        moves.fetch_add(1);
+    }
+};
+
+struct AllocationStats {
+    std::atomic<int> allocated{0};
+    std::atomic<int> freed{0};
+};
+
+// Stateful allocator that counts through a shared stats block
+template<typename T>
+struct CountingAllocator {
+    using value_type = T;
+    AllocationStats* stats;
+
+    explicit CountingAllocator(AllocationStats* s) noexcept : stats(s) {}
+
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>& other) noexcept : stats(other.stats) {}
+
+    T* allocate(std::size_t n) {
+        stats->allocated.fetch_add(static_cast<int>(n));
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept {
+        stats->freed.fetch_add(static_cast<int>(n));
+        ::operator delete(ptr, std::align_val_t{alignof(T)});
+    }
+
+    template<typename U>
+    bool operator==(const CountingAllocator<U>& other) const noexcept {
+        return stats == other.stats;
+    }
+};
+
+} // namespace
+
+TEST_F(LockFreeQueueTest, EmplaceConstructsInPlace) {
+    LockFreeQueue<Emplaced> queue;
+    auto token = queue.make_producer_token();
+    Emplaced::moves.store(0);
+
+    ASSERT_TRUE(queue.emplace(1, "one"));
+    ASSERT_TRUE(queue.emplace(token, 2, "two"));
+    ASSERT_EQ(Emplaced::moves.load(), 0); // Built straight into the nodes
+
+    auto first = queue.dequeue();
+    auto second = queue.dequeue();
+    ASSERT_TRUE(first.has_value() && second.has_value());
+    // Lanes are consumed in rotation, so either may come out first
+    ASSERT_EQ(first->id + second->id, 3);
+    ASSERT_EQ(first->name, first->id == 1 ? "one" : "two");
+    ASSERT_EQ(second->name, second->id == 1 ? "one" : "two");
+
+    queue.close();
+    ASSERT_FALSE(queue.emplace(3, "three"));
+}
+
+TEST_F(LockFreeQueueTest, CustomAllocatorServesEveryNode) {
+    // Outlives the queue: retired nodes are freed by later epoch collections
+    static AllocationStats stats;
+    using Queue = LockFreeQueue<std::string, EpochDomain, CountingAllocator<std::string>>;
+    const int allocated_before = stats.allocated.load();
+    {
+        Queue queue{CountingAllocator<std::string>(&stats)};
+        auto token = queue.make_producer_token();
+        std::vector<std::thread> producers;
+        producers.reserve(2);
+        for (int p = 0; p < 2; ++p) {
+            producers.emplace_back([&, p]() {
+                for (int i = 0; i < 1000; ++i) {
+                    std::string value = "item-" + std::to_string(i);
+                    if (p == 0) {
+                        queue.enqueue(value);
+                    } else {
+                        queue.emplace(token, std::move(value));
+                    }
+                }
+            });
+        }
+        for (auto& t : producers) {
+            t.join();
+        }
+        for (int i = 0; i < 1500; ++i) {
+            ASSERT_TRUE(queue.dequeue().has_value());
+        }
+        // Two dummies plus one node per item
+        ASSERT_EQ(stats.allocated.load() - allocated_before, 2002);
+    }
+    for (int i = 0; i < 10 && stats.freed.load() < stats.allocated.load(); ++i) {
+        EpochDomain::collect();
+    }
+    ASSERT_EQ(stats.freed.load(), stats.allocated.load());
+}
+
+// ========== BoundedQueue: same scenarios as LockFreeQueue ==========
+
+class BoundedQueueTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(BoundedQueueTest, BasicEnqueueDequeue) {
+    BoundedQueue<int, 16> queue;
+
+    ASSERT_TRUE(queue.try_enqueue(42));
+    auto result = queue.try_dequeue();
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result.value(), 42);
+}
+
+TEST_F(BoundedQueueTest, EmptyQueue) {
+    BoundedQueue<int, 16> queue;
+
+    ASSERT_TRUE(queue.empty());
+    auto result = queue.try_dequeue();
+    ASSERT_FALSE(result.has_value());
+}
+
+TEST_F(BoundedQueueTest, MultipleElements) {
+    BoundedQueue<int, 128> queue;
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(queue.try_enqueue(i));
+    }
+    ASSERT_EQ(queue.approximate_size(), 100u);
+
+    for (int i = 0; i < 100; ++i) {
+        auto result = queue.try_dequeue();
+        ASSERT_TRUE(result.has_value());
+        ASSERT_EQ(result.value(), i);
+    }
+
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(BoundedQueueTest, FullQueueRejectsAndKeepsItem) {
+    BoundedQueue<std::unique_ptr<int>, 4> queue;
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_enqueue(std::make_unique<int>(i)));
+    }
+
+    auto extra = std::make_unique<int>(99);
+    ASSERT_FALSE(queue.try_enqueue(std::move(extra)));
+    ASSERT_NE(extra, nullptr); // Not consumed on failure
+
+    ASSERT_EQ(*queue.try_dequeue().value(), 0);
+    ASSERT_TRUE(queue.try_enqueue(std::move(extra)));
+}
+
+TEST_F(BoundedQueueTest, WrapAround) {
+    BoundedQueue<int, 8> queue;
+
+    for (int lap = 0; lap < 1000; ++lap) {
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_TRUE(queue.try_enqueue(lap * 5 + i));
+        }
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_EQ(queue.try_dequeue().value(), lap * 5 + i);
+        }
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(BoundedQueueTest, ConcurrentEnqueue) {
+    constexpr int num_threads = 8;
+    constexpr int items_per_thread = 1000;
+    BoundedQueue<int, 8192> queue;
+
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&queue, t]() {
+            for (int i = 0; i < items_per_thread; ++i) {
+                ASSERT_TRUE(queue.try_enqueue(t * items_per_thread + i));
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<bool> found(num_threads * items_per_thread, false);
+    int count = 0;
+
+    while (auto result = queue.try_dequeue()) {
+        int value = result.value();
+        ASSERT_GE(value, 0);
+        ASSERT_LT(value, num_threads * items_per_thread);
+        found[value] = true;
+        ++count;
+    }
+
+    ASSERT_EQ(count, num_threads * items_per_thread);
+    for (bool f : found) {
+        ASSERT_TRUE(f);
+    }
+}
+
+TEST_F(BoundedQueueTest, ConcurrentProducerConsumer) {
+    constexpr int num_producers = 4;
+    constexpr int num_consumers = 4;
+    constexpr int items_per_producer = 10000;
+    BoundedQueue<int, 64> queue; // Small ring to exercise full/empty transitions
+
+    std::atomic<int> consumed{0};
+    std::atomic<long long> sum{0};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_producers; ++t) {
+        threads.emplace_back([&queue, t]() {
+            for (int i = 0; i < items_per_producer; ++i) {
+                while (!queue.try_enqueue(t * items_per_producer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (int t = 0; t < num_consumers; ++t) {
+        threads.emplace_back([&queue, &consumed, &sum]() {
+            while (consumed.load() < num_producers * items_per_producer) {
+                if (auto result = queue.try_dequeue()) {
+                    sum.fetch_add(result.value());
+                    consumed.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const long long n = num_producers * items_per_producer;
+    ASSERT_EQ(consumed.load(), n);
+    ASSERT_EQ(sum.load(), n * (n - 1) / 2);
+}
+
+TEST_F(BoundedQueueTest, MoveSemantics) {
+    BoundedQueue<std::unique_ptr<int>, 4> queue;
+
+    auto ptr = std::make_unique<int>(42);
+    queue.try_enqueue(std::move(ptr));
+
+    auto result = queue.try_dequeue();
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(*result.value(), 42);
+}
+
+TEST_F(BoundedQueueTest, DestructorDestroysRemainingItems) {
+    Counted::live.store(0);
+    {
+        BoundedQueue<Counted, 8> queue;
+        for (int i = 0; i < 6; ++i) {
+            queue.try_enqueue(Counted(i));
+        }
+        queue.try_dequeue();
+        ASSERT_EQ(Counted::live.load(), 5);
+    }
+    ASSERT_EQ(Counted::live.load(), 0);
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include "concurrent/priority_queue.hpp"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace concurrent;
+
+class PriorityQueueTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(PriorityQueueTest, PopsInKeyOrder) {
+    ConcurrentPriorityQueue<int, std::string> queue;
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.try_pop().has_value());
+
+    std::vector<int> keys{5, 1, 9, 3, 7, 2, 8, 4, 6, 0};
+    for (int key : keys) {
+        queue.push(key, "v" + std::to_string(key));
+    }
+    ASSERT_FALSE(queue.empty());
+    ASSERT_EQ(queue.approximate_size(), keys.size());
+
+    for (int expected = 0; expected < 10; ++expected) {
+        auto item = queue.try_pop();
+        ASSERT_TRUE(item.has_value());
+        ASSERT_EQ(item->first, expected);
+        ASSERT_EQ(item->second, "v" + std::to_string(expected));
+    }
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.approximate_size(), 0u);
+}
+
+TEST_F(PriorityQueueTest, DuplicateKeysAndCustomCompare) {
+    ConcurrentPriorityQueue<int, int, std::greater<int>> queue;
+    for (int i = 0; i < 100; ++i) {
+        queue.push(i % 10, i);
+    }
+
+    int last_key = 10;
+    std::vector<int> values;
+    while (auto item = queue.try_pop()) {
+        ASSERT_LE(item->first, last_key); // Largest first under std::greater
+        ASSERT_EQ(item->second % 10, item->first);
+        last_key = item->first;
+        values.push_back(item->second);
+    }
+    std::sort(values.begin(), values.end());
+    ASSERT_EQ(values.size(), 100u);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(values[i], i);
+    }
+}
+
+TEST_F(PriorityQueueTest, MoveOnlyValues) {
+    ConcurrentPriorityQueue<int, std::unique_ptr<int>> queue;
+    queue.push(2, std::make_unique<int>(20));
+    queue.push(1, std::make_unique<int>(10));
+
+    auto first = queue.try_pop();
+    ASSERT_TRUE(first.has_value());
+    ASSERT_EQ(*first->second, 10);
+
+    // The remaining element is destroyed with the queue
+    queue.push(3, std::make_unique<int>(30));
+}
+
+TEST_F(PriorityQueueTest, RelaxedPopStaysNearMinimum) {
+    // Sized for 64 consumers so the walk really spreads out
+    ConcurrentPriorityQueue<int, int> queue(64);
+    const int depth = 4096;
+    const int rounds = 20000;
+    const int n = depth + rounds;
+    for (int i = 0; i < depth; ++i) {
+        queue.push(i, i);
+    }
+
+    // Fenwick tree over popped keys: rank = smaller keys still queued
+    std::vector<int> popped_below(n + 1, 0);
+    auto count_popped = [&](int key) {
+        int count = 0;
+        for (int i = key; i > 0; i -= i & -i) {
+            count += popped_below[i];
+        }
+        return count;
+    };
+    std::vector<bool> seen(n, false);
+    int worst_rank = 0;
+    for (int round = 0; round < n; ++round) {
+        // Steady state: one new, larger key per pop, then drain
+        if (round < rounds) {
+            queue.push(depth + round, depth + round);
+        }
+        auto item = queue.try_pop_relaxed();
+        ASSERT_TRUE(item.has_value());
+        int key = item->first;
+        ASSERT_FALSE(seen[key]);
+        seen[key] = true;
+        if (round < rounds) {
+            worst_rank = std::max(worst_rank, key - count_popped(key));
+        }
+        for (int i = key + 1; i <= n; i += i & -i) {
+            ++popped_below[i];
+        }
+    }
+    ASSERT_FALSE(queue.try_pop_relaxed().has_value());
+    // Every key came out, and always from near the front
+    ASSERT_LT(worst_rank, 2000);
+}
+
+namespace {
+
+// Producers push unique keys while consumers pop; every key must come out once
+void run_concurrent_push_pop(bool relaxed) {
+    ConcurrentPriorityQueue<int, int> queue(4);
+    const int num_producers = 4;
+    const int num_consumers = 4;
+    const int items_per_producer = 5000;
+    const int total = num_producers * items_per_producer;
+
+    std::vector<std::atomic<int>> taken(total);
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> threads;
+    threads.reserve(num_producers + num_consumers);
+
+    for (int p = 0; p < num_producers; ++p) {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < items_per_producer; ++i) {
+                int key = i * num_producers + p;
+                queue.push(key, key);
+            }
+        });
+    }
+    for (int c = 0; c < num_consumers; ++c) {
+        threads.emplace_back([&]() {
+            while (consumed.load() < total) {
+                auto item = relaxed ? queue.try_pop_relaxed() : queue.try_pop();
+                if (item) {
+                    ASSERT_EQ(item->first, item->second);
+                    taken[item->first].fetch_add(1);
+                    consumed.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (int i = 0; i < total; ++i) {
+        ASSERT_EQ(taken[i].load(), 1) << "key " << i;
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+} // namespace
+
+TEST_F(PriorityQueueTest, ConcurrentPushPop) {
+    run_concurrent_push_pop(false);
+}
+
+TEST_F(PriorityQueueTest, ConcurrentPushRelaxedPop) {
+    run_concurrent_push_pop(true);
+}
@@ -0,0 +1,333 @@
+#include <gtest/gtest.h>
+#include "concurrent/epoch.hpp"
+#include "concurrent/hazard_pointer.hpp"
+#include "concurrent/lockfree_hashmap.hpp"
+#include "concurrent/lockfree_queue.hpp"
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <mutex>
+
+using namespace concurrent;
+
+namespace {
+
+// Object whose reclamation is observable without actually freeing memory
+// that a buggy reader might still touch
+struct Tracked {
+    std::atomic<bool> retired{false};
+    int value;
+
+    explicit Tracked(int v) : value(v) {}
+};
+
+std::atomic<int> g_reclaimed{0};
+std::mutex g_graveyard_mutex;
+std::vector<Tracked*> g_graveyard;
+
+void bury(void* p) {
+    auto* obj = static_cast<Tracked*>(p);
+    obj->retired.store(true, std::memory_order_release);
+    g_reclaimed.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(g_graveyard_mutex);
+    g_graveyard.push_back(obj);
+}
+
+void empty_graveyard() {
+    std::lock_guard<std::mutex> lock(g_graveyard_mutex);
+    for (Tracked* obj : g_graveyard) {
+        delete obj;
+    }
+    g_graveyard.clear();
+}
+
+} // namespace
+
+class ReclamationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        g_reclaimed.store(0);
+    }
+    void TearDown() override {
+        empty_graveyard();
+    }
+};
+
+TEST_F(ReclamationTest, EpochRetiredObjectsAreEventuallyReclaimed) {
+    constexpr int count = 100;
+    for (int i = 0; i < count; ++i) {
+        EpochDomain::retire(new Tracked(i), &bury);
+    }
+
+    for (int i = 0; i < 8 && g_reclaimed.load() < count; ++i) {
+        EpochDomain::collect();
+    }
+
+    ASSERT_EQ(g_reclaimed.load(), count);
+}
+
+TEST_F(ReclamationTest, EpochGuardDelaysReclamation) {
+    std::atomic<bool> pinned{false};
+    std::atomic<bool> release{false};
+
+    std::thread reader([&]() {
+        EpochDomain::Guard guard;
+        pinned.store(true);
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    });
+
+    while (!pinned.load()) {
+        std::this_thread::yield();
+    }
+
+    EpochDomain::retire(new Tracked(1), &bury);
+    for (int i = 0; i < 8; ++i) {
+        EpochDomain::collect();
+    }
+    ASSERT_EQ(g_reclaimed.load(), 0);
+
+    release.store(true);
+    reader.join();
+
+    for (int i = 0; i < 8 && g_reclaimed.load() == 0; ++i) {
+        EpochDomain::collect();
+    }
+    ASSERT_EQ(g_reclaimed.load(), 1);
+}
+
+TEST_F(ReclamationTest, EpochConcurrentReadersNeverSeeReclaimed) {
+    constexpr int num_readers = 4;
+    constexpr int swaps = 20000;
+
+    std::atomic<Tracked*> shared{new Tracked(0)};
+    std::atomic<bool> running{true};
+    std::atomic<int> violations{0};
+    std::vector<std::thread> readers;
+
+    for (int t = 0; t < num_readers; ++t) {
+        readers.emplace_back([&]() {
+            while (running.load(std::memory_order_relaxed)) {
+                EpochDomain::Guard guard;
+                Tracked* obj = shared.load(std::memory_order_acquire);
+                if (obj->retired.load(std::memory_order_acquire)) {
+                    violations.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (int i = 1; i <= swaps; ++i) {
+        Tracked* old = shared.exchange(new Tracked(i), std::memory_order_acq_rel);
+        EpochDomain::retire(old, &bury);
+    }
+
+    running.store(false);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    for (int i = 0; i < 8 && g_reclaimed.load() < swaps; ++i) {
+        EpochDomain::collect();
+    }
+
+    ASSERT_EQ(violations.load(), 0);
+    ASSERT_EQ(g_reclaimed.load(), swaps);
+    delete shared.load();
+}
+
+TEST_F(ReclamationTest, QueueReclaimsDequeuedNodes) {
+    LockFreeQueue<int> queue;
+    constexpr int num_threads = 4;
+    constexpr int items_per_thread = 20000;
+
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&queue, t]() {
+            for (int i = 0; i < items_per_thread; ++i) {
+                queue.enqueue(t * items_per_thread + i);
+            }
+        });
+        threads.emplace_back([&queue, &consumed]() {
+            while (consumed.load() < num_threads * items_per_thread) {
+                if (queue.dequeue().has_value()) {
+                    consumed.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(consumed.load(), num_threads * items_per_thread);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_GT(EpochDomain::epoch(), 0u);
+}
+
+TEST_F(ReclamationTest, HazardRetiredObjectsAreReclaimedByScan) {
+    constexpr int count = 100;
+    for (int i = 0; i < count; ++i) {
+        HazardPointerDomain::retire(new Tracked(i), &bury);
+    }
+    HazardPointerDomain::collect();
+
+    ASSERT_EQ(g_reclaimed.load(), count);
+}
+
+TEST_F(ReclamationTest, HazardGuardProtectsAnnouncedPointer) {
+    std::atomic<Tracked*> shared{new Tracked(1)};
+    std::atomic<bool> protected_ptr{false};
+    std::atomic<bool> release{false};
+
+    std::thread reader([&]() {
+        HazardPointerDomain::Guard guard;
+        Tracked* obj = guard.protect(0, shared);
+        protected_ptr.store(true);
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+        ASSERT_FALSE(obj->retired.load());
+    });
+
+    while (!protected_ptr.load()) {
+        std::this_thread::yield();
+    }
+
+    Tracked* old = shared.exchange(nullptr);
+    HazardPointerDomain::retire(old, &bury);
+    HazardPointerDomain::collect();
+    ASSERT_EQ(g_reclaimed.load(), 0);
+
+    release.store(true);
+    reader.join();
+
+    HazardPointerDomain::collect();
+    ASSERT_EQ(g_reclaimed.load(), 1);
+}
+
+TEST_F(ReclamationTest, HazardGuardsNestDeeperThanOneBlock) {
+    // Four guards fill a thread's first block of slots; the rest chain on more
+    constexpr int depth = 10;
+    std::atomic<Tracked*> shared[depth];
+    for (int i = 0; i < depth; ++i) {
+        shared[i].store(new Tracked(i));
+    }
+
+    int reclaimed_before = 0;
+    auto nest = [&](auto& self, int level) -> void {
+        HazardPointerDomain::Guard guard;
+        Tracked* obj = guard.protect(0, shared[level]);
+        if (level + 1 < depth) {
+            self(self, level + 1);
+        } else {
+            for (auto& slot : shared) {
+                HazardPointerDomain::retire(slot.exchange(nullptr), &bury);
+            }
+            HazardPointerDomain::collect();
+            ASSERT_EQ(g_reclaimed.load(), reclaimed_before);
+        }
+        ASSERT_FALSE(obj->retired.load());
+    };
+    nest(nest, 0);
+
+    HazardPointerDomain::collect();
+    ASSERT_EQ(g_reclaimed.load(), depth);
+
+    // Slots taken down again: the same depth reuses the chained blocks
+    for (int i = 0; i < depth; ++i) {
+        shared[i].store(new Tracked(i));
+    }
+    reclaimed_before = depth;
+    nest(nest, 0);
+    HazardPointerDomain::collect();
+    ASSERT_EQ(g_reclaimed.load(), 2 * depth);
+}
+
+TEST_F(ReclamationTest, HazardQueueProducerConsumer) {
+    LockFreeQueue<int, HazardPointerDomain> queue;
+    constexpr int num_threads = 4;
+    constexpr int items_per_thread = 20000;
+
+    std::atomic<long long> sum{0};
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&queue, t]() {
+            for (int i = 0; i < items_per_thread; ++i) {
+                queue.enqueue(t * items_per_thread + i);
+            }
+        });
+        threads.emplace_back([&queue, &consumed, &sum]() {
+            while (consumed.load() < num_threads * items_per_thread) {
+                if (auto item = queue.dequeue()) {
+                    sum.fetch_add(*item);
+                    consumed.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const long long n = num_threads * items_per_thread;
+    ASSERT_EQ(sum.load(), n * (n - 1) / 2);
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(ReclamationTest, HazardHashMapReadHeavyWithErase) {
+    LockFreeHashMap<int, int, std::hash<int>, HazardPointerDomain> map(64);
+    constexpr int num_keys = 256;
+    constexpr int num_readers = 6;
+    constexpr int writer_rounds = 200;
+
+    for (int k = 0; k < num_keys; ++k) {
+        map.insert(k, k);
+    }
+
+    std::atomic<bool> running{true};
+    std::atomic<int> bad_reads{0};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_readers; ++t) {
+        threads.emplace_back([&map, &running, &bad_reads]() {
+            while (running.load(std::memory_order_relaxed)) {
+                for (int k = 0; k < num_keys; ++k) {
+                    auto value = map.get(k);
+                    if (value.has_value() && value.value() != k) {
+                        bad_reads.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+
+    threads.emplace_back([&map, &running]() {
+        for (int round = 0; round < writer_rounds; ++round) {
+            for (int k = round % 2; k < num_keys; k += 2) {
+                map.erase(k);
+            }
+            for (int k = round % 2; k < num_keys; k += 2) {
+                map.insert(k, k);
+            }
+        }
+        running.store(false);
+    });
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(bad_reads.load(), 0);
+    ASSERT_EQ(map.size(), static_cast<size_t>(num_keys));
+    for (int k = 0; k < num_keys; ++k) {
+        ASSERT_TRUE(map.contains(k));
+    }
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include "concurrent/hazard_pointer.hpp"
+#include "concurrent/segmented_queue.hpp"
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <string>
+
+using namespace concurrent;
+
+class SegmentedQueueTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+struct LiveCount {
+    static inline std::atomic<int> live{0};
+    int value;
+
+    explicit LiveCount(int v) : value(v) {
+        live.fetch_add(1);
+    }
+    LiveCount(LiveCount&& other) noexcept : value(other.value) {
+        live.fetch_add(1);
+    }
+    ~LiveCount() {
+        live.fetch_sub(1);
+    }
+};
+
+// Producers and consumers race across many small segments
+template<typename Queue>
+void run_producer_consumer() {
+    constexpr int num_producers = 4;
+    constexpr int num_consumers = 4;
+    constexpr int items_per_producer = 20000;
+    Queue queue;
+
+    std::atomic<int> consumed{0};
+    std::atomic<long long> sum{0};
+    std::atomic<int> order_violations{0};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_producers; ++t) {
+        threads.emplace_back([&queue, t]() {
+            for (int i = 0; i < items_per_producer; ++i) {
+                queue.enqueue(t * items_per_producer + i);
+            }
+        });
+    }
+
+    for (int t = 0; t < num_consumers; ++t) {
+        threads.emplace_back([&]() {
+            std::vector<int> last(num_producers, -1);
+            while (consumed.load() < num_producers * items_per_producer) {
+                if (auto item = queue.dequeue()) {
+                    int producer = *item / items_per_producer;
+                    if (*item <= last[producer]) {
+                        order_violations.fetch_add(1);
+                    }
+                    last[producer] = *item;
+                    sum.fetch_add(*item);
+                    consumed.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const long long n = num_producers * items_per_producer;
+    ASSERT_EQ(consumed.load(), n);
+    ASSERT_EQ(sum.load(), n * (n - 1) / 2);
+    ASSERT_EQ(order_violations.load(), 0);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.dequeue().has_value());
+}
+
+} // namespace
+
+TEST_F(SegmentedQueueTest, BasicEnqueueDequeue) {
+    SegmentedQueue<int> queue;
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.dequeue().has_value());
+
+    queue.enqueue(42);
+    ASSERT_EQ(queue.approximate_size(), 1u);
+    ASSERT_EQ(queue.dequeue().value(), 42);
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(SegmentedQueueTest, FifoAcrossSegments) {
+    SegmentedQueue<int, EpochDomain, 8> queue;
+
+    for (int i = 0; i < 100; ++i) {
+        queue.enqueue(i);
+    }
+    ASSERT_EQ(queue.approximate_size(), 100u);
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(queue.dequeue().value(), i);
+    }
+    ASSERT_TRUE(queue.empty());
+
+    // Dequeues on an empty queue must not strand later elements
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_FALSE(queue.dequeue().has_value());
+    }
+    queue.enqueue(7);
+    ASSERT_EQ(queue.dequeue().value(), 7);
+}
+
+TEST_F(SegmentedQueueTest, DestructorDestroysRemainingItems) {
+    LiveCount::live.store(0);
+    {
+        SegmentedQueue<LiveCount, EpochDomain, 4> queue;
+        for (int i = 0; i < 10; ++i) {
+            queue.enqueue(LiveCount(i));
+        }
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_EQ(queue.dequeue()->value, i);
+        }
+        ASSERT_EQ(LiveCount::live.load(), 7);
+    }
+    ASSERT_EQ(LiveCount::live.load(), 0);
+}
+
+TEST_F(SegmentedQueueTest, MoveOnlyPayload) {
+    SegmentedQueue<std::unique_ptr<std::string>> queue;
+    queue.enqueue(std::make_unique<std::string>("segment"));
+
+    auto result = queue.dequeue();
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(**result, "segment");
+}
+
+TEST_F(SegmentedQueueTest, ConcurrentProducerConsumer) {
+    run_producer_consumer<SegmentedQueue<int, EpochDomain, 64>>();
+}
+
+TEST_F(SegmentedQueueTest, ConcurrentProducerConsumerHazardPointers) {
+    run_producer_consumer<SegmentedQueue<int, HazardPointerDomain, 64>>();
+}
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include "concurrent/shared_queue.hpp"
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#if defined(__linux__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace concurrent;
+
+class SharedQueueTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+#if defined(__linux__)
+
+namespace {
+
+struct Message {
+    std::uint32_t producer;
+    std::uint64_t sequence;
+    char tag[16];
+};
+
+// Forks a child that runs fn and exits with its return value
+template<typename F>
+pid_t fork_child(F fn) {
+    pid_t pid = ::fork();
+    if (pid == 0) {
+        ::_exit(fn());
+    }
+    return pid;
+}
+
+int wait_child(pid_t pid) {
+    int status = 0;
+    if (::waitpid(pid, &status, 0) != pid || !WIFEXITED(status)) {
+        return -1;
+    }
+    return WEXITSTATUS(status);
+}
+
+} // namespace
+
+TEST_F(SharedQueueTest, BasicEnqueueDequeue) {
+    auto queue = SharedBoundedQueue<int, 4>::create_anonymous();
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.try_dequeue().has_value());
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_enqueue(i));
+    }
+    ASSERT_FALSE(queue.try_enqueue(4));
+    ASSERT_EQ(queue.approximate_size(), 4u);
+
+    for (int i = 0; i < 4; ++i) {
+        auto item = queue.try_dequeue();
+        ASSERT_TRUE(item.has_value());
+        ASSERT_EQ(*item, i);
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(SharedQueueTest, SecondMappingSeesSameQueue) {
+    auto queue = SharedBoundedQueue<Message, 16>::create_anonymous();
+    // Mapped again at another address: only offsets are stored in the region
+    SharedBoundedQueue<Message, 16> other(SharedMemory::attach(queue.memory().fd()));
+    ASSERT_NE(other.memory().data(), queue.memory().data());
+
+    ASSERT_TRUE(queue.try_enqueue(Message{1, 42, "hello"}));
+    auto item = other.try_dequeue();
+    ASSERT_TRUE(item.has_value());
+    ASSERT_EQ(item->sequence, 42u);
+    ASSERT_EQ(std::string(item->tag), "hello");
+    ASSERT_TRUE(queue.empty());
+
+    // A different element type or capacity is refused
+    ASSERT_THROW((SharedBoundedQueue<Message, 32>(SharedMemory::attach(queue.memory().fd()))),
+                 std::exception);
+    ASSERT_THROW((SharedBoundedQueue<std::uint64_t, 16>(SharedMemory::attach(queue.memory().fd()))),
+                 std::runtime_error);
+}
+
+TEST_F(SharedQueueTest, ForkedProducersKeepPerProducerOrder) {
+    constexpr std::uint32_t num_producers = 3;
+    constexpr std::uint64_t per_producer = 20000;
+    auto queue = SharedBoundedQueue<Message, 64>::create_anonymous();
+
+    pid_t children[num_producers];
+    for (std::uint32_t p = 0; p < num_producers; ++p) {
+        children[p] = fork_child([&queue, p]() {
+            for (std::uint64_t i = 0; i < per_producer; ++i) {
+                while (!queue.try_enqueue(Message{p, i, "payload"})) {
+                    std::this_thread::yield();
+                }
+            }
+            return 0;
+        });
+        ASSERT_GT(children[p], 0);
+    }
+
+    std::uint64_t next[num_producers] = {};
+    std::uint64_t received = 0;
+    int order_violations = 0;
+    while (received < num_producers * per_producer) {
+        auto item = queue.try_dequeue();
+        if (!item) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (item->producer >= num_producers || item->sequence != next[item->producer]) {
+            ++order_violations;
+        } else {
+            ++next[item->producer];
+        }
+        ++received;
+    }
+
+    for (pid_t child : children) {
+        ASSERT_EQ(wait_child(child), 0);
+    }
+    ASSERT_EQ(order_violations, 0);
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(SharedQueueTest, NamedQueueOpenedByAnotherProcess) {
+    constexpr std::uint64_t count = 50000;
+    const std::string name = "/concurrent-test-" + std::to_string(::getpid());
+    SharedMemory::unlink(name);
+    auto queue = SharedBoundedQueue<std::uint64_t, 128>::open(name);
+
+    // The child maps the queue by name on its own instead of inheriting it
+    pid_t child = fork_child([&name]() {
+        auto own = SharedBoundedQueue<std::uint64_t, 128>::open(name);
+        std::uint64_t sum = 0;
+        for (std::uint64_t received = 0; received < count;) {
+            if (auto item = own.try_dequeue()) {
+                sum += *item;
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        return sum == count * (count - 1) / 2 ? 0 : 1;
+    });
+    ASSERT_GT(child, 0);
+
+    for (std::uint64_t i = 0; i < count; ++i) {
+        while (!queue.try_enqueue(i)) {
+            std::this_thread::yield();
+        }
+    }
+    int status = wait_child(child);
+    SharedMemory::unlink(name);
+    ASSERT_EQ(status, 0);
+}
+
+TEST_F(SharedQueueTest, AttachTakesOverFromDeadInitializer) {
+    using Queue = SharedBoundedQueue<int, 8>;
+    auto memory = SharedMemory::create_anonymous(Queue::region_size());
+    pid_t dead = fork_child([]() { return 0; });
+    ASSERT_GT(dead, 0);
+    ASSERT_EQ(wait_child(dead), 0);
+
+    // As left by an initializer killed before it finished: pid << 32 | initializing
+    std::uint64_t stale = (static_cast<std::uint64_t>(dead) << 32) | 1;
+    std::memcpy(memory.data(), &stale, sizeof(stale));
+
+    Queue queue(std::move(memory));
+    ASSERT_TRUE(queue.empty());
+    ASSERT_TRUE(queue.try_enqueue(7));
+    auto item = queue.try_dequeue();
+    ASSERT_TRUE(item.has_value());
+    ASSERT_EQ(*item, 7);
+}
+
+TEST_F(SharedQueueTest, AttachRejectsUnknownState) {
+    using Queue = SharedBoundedQueue<int, 8>;
+    auto memory = SharedMemory::create_anonymous(Queue::region_size());
+    std::uint64_t garbage = 7;
+    std::memcpy(memory.data(), &garbage, sizeof(garbage));
+    ASSERT_THROW(Queue(std::move(memory)), std::runtime_error);
+}
+
+#endif
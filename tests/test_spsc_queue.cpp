@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "concurrent/spsc_queue.hpp"
+#include <thread>
+#include <vector>
+#include <memory>
+#include <iterator>
+
+using namespace concurrent;
+
+class SpscQueueTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(SpscQueueTest, BasicEnqueueDequeue) {
+    SpscQueue<int> queue(16);
+
+    ASSERT_TRUE(queue.try_enqueue(42));
+    auto result = queue.try_dequeue();
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result.value(), 42);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.try_dequeue().has_value());
+}
+
+TEST_F(SpscQueueTest, CapacityRoundsUpToPowerOfTwo) {
+    SpscQueue<int> queue(100);
+    ASSERT_EQ(queue.capacity(), 128u);
+
+    for (int i = 0; i < 128; ++i) {
+        ASSERT_TRUE(queue.try_enqueue(i));
+    }
+    ASSERT_FALSE(queue.try_enqueue(128));
+
+    ASSERT_EQ(queue.try_dequeue().value(), 0);
+    ASSERT_TRUE(queue.try_enqueue(128));
+    ASSERT_EQ(queue.approximate_size(), 128u);
+}
+
+TEST_F(SpscQueueTest, BulkOperationsStopAtCapacity) {
+    SpscQueue<int> queue(8);
+    std::vector<int> input(20);
+    for (int i = 0; i < 20; ++i) {
+        input[i] = i;
+    }
+
+    ASSERT_EQ(queue.try_enqueue_bulk(input.begin(), input.size()), 8u);
+    ASSERT_EQ(queue.try_enqueue_bulk(input.begin(), input.size()), 0u);
+
+    std::vector<int> output;
+    ASSERT_EQ(queue.try_dequeue_bulk(std::back_inserter(output), 5), 5u);
+    ASSERT_EQ(queue.try_enqueue_bulk(input.begin() + 8, 12), 5u);
+    ASSERT_EQ(queue.try_dequeue_bulk(std::back_inserter(output), 100), 8u);
+
+    ASSERT_EQ(output.size(), 13u);
+    for (int i = 0; i < 13; ++i) {
+        ASSERT_EQ(output[i], i);
+    }
+}
+
+TEST_F(SpscQueueTest, MoveOnlyAndDestructor) {
+    auto tracker = std::make_shared<int>(0);
+    {
+        SpscQueue<std::shared_ptr<int>> queue(4);
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_TRUE(queue.try_enqueue(tracker));
+        }
+        queue.try_dequeue();
+        ASSERT_EQ(tracker.use_count(), 3);
+    }
+    ASSERT_EQ(tracker.use_count(), 1);
+
+    SpscQueue<std::unique_ptr<int>> queue(4);
+    queue.try_enqueue(std::make_unique<int>(7));
+    ASSERT_EQ(*queue.try_dequeue().value(), 7);
+}
+
+TEST_F(SpscQueueTest, ProducerConsumerPreservesOrder) {
+    constexpr int num_items = 200000;
+    SpscQueue<int> queue(64); // Small ring to exercise wraparound and full/empty
+
+    std::thread producer([&queue]() {
+        for (int i = 0; i < num_items; ++i) {
+            while (!queue.try_enqueue(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    bool in_order = true;
+    while (expected < num_items) {
+        if (auto item = queue.try_dequeue()) {
+            in_order = in_order && item.value() == expected;
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    ASSERT_TRUE(in_order);
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(SpscQueueTest, BulkProducerConsumerPreservesOrder) {
+    constexpr int num_items = 200000;
+    constexpr int batch = 32;
+    SpscQueue<int> queue(256);
+
+    std::thread producer([&queue]() {
+        std::vector<int> buffer(batch);
+        for (int base = 0; base < num_items; base += batch) {
+            for (int i = 0; i < batch; ++i) {
+                buffer[i] = base + i;
+            }
+            std::size_t sent = 0;
+            while (sent < batch) {
+                sent += queue.try_enqueue_bulk(buffer.begin() + sent, batch - sent);
+                if (sent < batch) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    });
+
+    std::vector<int> received;
+    received.reserve(num_items);
+    while (received.size() < static_cast<std::size_t>(num_items)) {
+        if (queue.try_dequeue_bulk(std::back_inserter(received), 100) == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    for (int i = 0; i < num_items; ++i) {
+        ASSERT_EQ(received[i], i);
+    }
+}
@@ -196,7 +196,7 @@ TEST_F(StressTest, ThreadPoolExtremeLoad) {
                     // Simulate some work
                     volatile size_t sum = 0;
                     for (size_t j = 0; j < 100; ++j) {
-                        sum += i + j;
+                        sum = sum + i + j;
                     }
                     completed.fetch_add(1, std::memory_order_relaxed);
                 } catch (...) {
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+#include "concurrent/striped_counter.hpp"
+#include <thread>
+#include <vector>
+
+using namespace concurrent;
+
+class StripedCounterTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(StripedCounterTest, SingleThreaded) {
+    StripedCounter counter;
+    ASSERT_EQ(counter.sum(), 0);
+
+    counter.add(5);
+    counter.add(-2);
+    ASSERT_EQ(counter.sum(), 3);
+}
+
+TEST_F(StripedCounterTest, ConcurrentAddsAreExactWhenQuiescent) {
+    constexpr int num_threads = 2 * static_cast<int>(StripedCounter::kStripes);
+    constexpr int adds_per_thread = 10000;
+    StripedCounter counter;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&counter, t]() {
+            for (int i = 0; i < adds_per_thread; ++i) {
+                counter.add(t % 2 == 0 ? 3 : -1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(counter.sum(), static_cast<std::int64_t>(num_threads / 2) * adds_per_thread * 2);
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "concurrent/timer_wheel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace concurrent;
+
+class TimerWheelTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+using Clock = TimerWheel<int>::Clock;
+using std::chrono::milliseconds;
+
+} // namespace
+
+TEST_F(TimerWheelTest, ExpiresOnTimeOnEveryLevel) {
+    TimerWheel<int> wheel(milliseconds(1));
+    const auto start = Clock::now();
+    // Delays in ticks around the level boundaries (64, 64^2, 64^3, ...)
+    const std::vector<std::int64_t> delays{0, 1, 2, 63, 64, 65, 4095, 4096, 4097,
+                                           262143, 262144, 16777216, 1073741825};
+    for (std::size_t i = 0; i < delays.size(); ++i) {
+        wheel.schedule(static_cast<int>(i), start + milliseconds(delays[i]));
+    }
+    ASSERT_EQ(wheel.approximate_size(), delays.size());
+
+    for (std::size_t i = 0; i < delays.size(); ++i) {
+        const auto due = start + milliseconds(delays[i]);
+        // Just before the due time: nothing of this item yet
+        std::vector<int> early;
+        wheel.poll(due - std::chrono::microseconds(1), [&](int v) { early.push_back(v); });
+        ASSERT_TRUE(early.empty()) << "item " << i << " fired early";
+
+        // Items never fire early, and at most one tick late
+        std::vector<int> popped;
+        wheel.poll(due + milliseconds(1), [&](int v) { popped.push_back(v); });
+        ASSERT_EQ(popped, std::vector<int>{static_cast<int>(i)});
+    }
+    ASSERT_TRUE(wheel.empty());
+    ASSERT_FALSE(wheel.next_expiry().has_value());
+}
+
+TEST_F(TimerWheelTest, PastDueExpiresAtNextPoll) {
+    TimerWheel<std::unique_ptr<int>> wheel;
+    wheel.schedule(std::make_unique<int>(7), Clock::now() - milliseconds(100));
+    int value = 0;
+    ASSERT_EQ(wheel.poll([&](std::unique_ptr<int>&& p) { value = *p; }), 1u);
+    ASSERT_EQ(value, 7);
+}
+
+TEST_F(TimerWheelTest, NextExpiryIsNeverLate) {
+    TimerWheel<int> wheel(milliseconds(1));
+    const auto start = Clock::now();
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> delay(1, 5000000);
+    std::vector<Clock::time_point> due_of;
+    for (int i = 0; i < 1000; ++i) {
+        due_of.push_back(start + milliseconds(delay(rng)));
+        wheel.schedule(i, due_of.back());
+    }
+    std::vector<Clock::time_point> dues = due_of;
+    std::sort(dues.begin(), dues.end());
+
+    // Jumping from wake-up to wake-up pops every item, none of them early
+    std::size_t popped = 0;
+    while (auto wake = wheel.next_expiry()) {
+        ASSERT_LE(*wake, dues[popped] + wheel.resolution());
+        wheel.poll(*wake, [&](int v) {
+            ASSERT_LE(due_of[v], *wake);
+            ++popped;
+        });
+    }
+    ASSERT_EQ(popped, dues.size());
+}
+
+TEST_F(TimerWheelTest, ConcurrentSchedulersLoseNothing) {
+    TimerWheel<int> wheel(milliseconds(1));
+    const int num_producers = 4;
+    const int per_producer = 20000;
+    const int total = num_producers * per_producer;
+    const auto start = Clock::now();
+
+    std::vector<std::atomic<int>> seen(total);
+    std::atomic<int> producers_done{0};
+    std::vector<std::thread> threads;
+    threads.reserve(num_producers);
+    for (int p = 0; p < num_producers; ++p) {
+        threads.emplace_back([&, p]() {
+            std::mt19937 rng(p);
+            std::uniform_int_distribution<int> delay(0, 100000);
+            for (int i = 0; i < per_producer; ++i) {
+                wheel.schedule(p * per_producer + i, start + milliseconds(delay(rng)));
+            }
+            producers_done.fetch_add(1);
+        });
+    }
+
+    // The consumer sweeps simulated time while producers are still scheduling
+    auto now = start;
+    auto record = [&](int v) { seen[v].fetch_add(1); };
+    while (producers_done.load() < num_producers) {
+        now += milliseconds(97);
+        wheel.poll(now, record);
+        std::this_thread::yield();
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    wheel.poll(start + milliseconds(200000), record);
+
+    for (int i = 0; i < total; ++i) {
+        ASSERT_EQ(seen[i].load(), 1) << "item " << i;
+    }
+    ASSERT_TRUE(wheel.empty());
+}
+
+TEST_F(TimerWheelTest, BlockingPollWakesForNewTimer) {
+    TimerWheel<int> wheel(milliseconds(1));
+    ASSERT_EQ(wheel.poll_for(milliseconds(5), [](int) {}), 0u);
+
+    // A far-off timer must not keep the consumer asleep past a sooner one
+    wheel.schedule_after(1, std::chrono::hours(1));
+    std::thread producer([&]() {
+        std::this_thread::sleep_for(milliseconds(20));
+        wheel.schedule_after(2, milliseconds(5));
+    });
+    std::vector<int> popped;
+    const auto begin = Clock::now();
+    wheel.poll_wait([&](int v) { popped.push_back(v); });
+    producer.join();
+
+    ASSERT_EQ(popped, std::vector<int>{2});
+    ASSERT_LT(Clock::now() - begin, std::chrono::seconds(10));
+    ASSERT_EQ(wheel.approximate_size(), 1u); // Destroyed with the wheel
+}
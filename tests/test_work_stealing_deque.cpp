@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include "concurrent/hazard_pointer.hpp"
+#include "concurrent/work_stealing_deque.hpp"
+#include <thread>
+#include <vector>
+#include <atomic>
+
+using namespace concurrent;
+
+class WorkStealingDequeTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+// The owner pushes and pops while thieves steal; every item must be taken once
+template<typename Deque>
+void run_owner_and_thieves(int num_thieves) {
+    constexpr int num_items = 100000;
+    Deque deque(8); // Small start so the buffer grows under contention
+
+    std::vector<std::atomic<int>> taken(num_items);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> thieves;
+
+    for (int t = 0; t < num_thieves; ++t) {
+        thieves.emplace_back([&]() {
+            while (!done.load()) {
+                if (auto item = deque.steal()) {
+                    taken[*item].fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < num_items; ++i) {
+        deque.push(i);
+        if (i % 3 == 0) {
+            if (auto item = deque.pop()) {
+                taken[*item].fetch_add(1);
+            }
+        }
+    }
+    while (auto item = deque.pop()) {
+        taken[*item].fetch_add(1);
+    }
+
+    done.store(true);
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+
+    for (int i = 0; i < num_items; ++i) {
+        ASSERT_EQ(taken[i].load(), 1) << "item " << i;
+    }
+    ASSERT_TRUE(deque.empty());
+}
+
+} // namespace
+
+TEST_F(WorkStealingDequeTest, OwnerPopsLifo) {
+    WorkStealingDeque<int> deque;
+
+    ASSERT_FALSE(deque.pop().has_value());
+    for (int i = 0; i < 10; ++i) {
+        deque.push(i);
+    }
+    ASSERT_EQ(deque.approximate_size(), 10u);
+
+    for (int i = 9; i >= 0; --i) {
+        ASSERT_EQ(deque.pop().value(), i);
+    }
+    ASSERT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, ThievesStealFifo) {
+    WorkStealingDeque<int> deque;
+    for (int i = 0; i < 10; ++i) {
+        deque.push(i);
+    }
+
+    ASSERT_EQ(deque.steal().value(), 0);
+    ASSERT_EQ(deque.steal().value(), 1);
+    ASSERT_EQ(deque.pop().value(), 9);
+    ASSERT_EQ(deque.approximate_size(), 7u);
+}
+
+TEST_F(WorkStealingDequeTest, GrowthPreservesElements) {
+    WorkStealingDeque<int> deque(4);
+    ASSERT_EQ(deque.capacity(), 4u);
+
+    // Wrap the indices before growing
+    for (int i = 0; i < 3; ++i) {
+        deque.push(-1);
+        deque.steal();
+    }
+    for (int i = 0; i < 1000; ++i) {
+        deque.push(i);
+    }
+    ASSERT_GE(deque.capacity(), 1000u);
+
+    for (int i = 0; i < 500; ++i) {
+        ASSERT_EQ(deque.steal().value(), i);
+    }
+    for (int i = 999; i >= 500; --i) {
+        ASSERT_EQ(deque.pop().value(), i);
+    }
+    ASSERT_FALSE(deque.steal().has_value());
+}
+
+TEST_F(WorkStealingDequeTest, OneThief) {
+    run_owner_and_thieves<WorkStealingDeque<int>>(1);
+}
+
+TEST_F(WorkStealingDequeTest, ManyThieves) {
+    run_owner_and_thieves<WorkStealingDeque<int>>(4);
+}
+
+TEST_F(WorkStealingDequeTest, ManyThievesHazardPointers) {
+    run_owner_and_thieves<WorkStealingDeque<int, HazardPointerDomain>>(4);
+}